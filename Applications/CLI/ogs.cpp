@@ -29,7 +29,9 @@
 // BaseLib
 #include "BaseLib/ConfigTreeUtil.h"
 #include "BaseLib/DateTools.h"
+#include "BaseLib/EventTracer.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/MemoryAccounting.h"
 #include "BaseLib/RunTime.h"
 #include "BaseLib/TemplateLogogFormatterSuppressedGCC.h"
 
@@ -104,6 +106,14 @@ int main(int argc, char* argv[])
                                   "file will not trigger program abortion");
     cmd.add(nonfatal_arg);
 
+    TCLAP::ValueArg<std::string> trace_arg(
+        "", "trace",
+        "records a timeline of the solver phases per thread and rank and "
+        "writes it as Chrome trace JSON to the given file, viewable in "
+        "chrome://tracing or Perfetto",
+        false, "", "FILE");
+    cmd.add(trace_arg);
+
     TCLAP::SwitchArg unbuffered_cout_arg("", "unbuffered-std-out",
                                          "use unbuffered standard output");
     cmd.add(unbuffered_cout_arg);
@@ -175,6 +185,10 @@ int main(int argc, char* argv[])
                     TOPIC_LINE_NUMBER_FLAG>>());
 #endif
             run_time.start();
+            if (trace_arg.isSet())
+            {
+                BaseLib::EventTracer::enable();
+            }
 
             auto project_config = BaseLib::makeConfigTree(
                 project_arg.getValue(), !nonfatal_arg.getValue(),
@@ -236,7 +250,10 @@ int main(int argc, char* argv[])
 
             auto& time_loop = project.getTimeLoop();
             time_loop.initialize();
+            BaseLib::MemoryAccounting::printCurrentUsage(
+                "after initialization");
             solver_succeeded = time_loop.loop();
+            BaseLib::MemoryAccounting::printPeakUsage();
 
 #ifdef USE_INSITU
             if (isInsituConfigured)
@@ -244,6 +261,11 @@ int main(int argc, char* argv[])
 #endif
             INFO("[time] Execution took %g s.", run_time.elapsed());
 
+            if (trace_arg.isSet())
+            {
+                BaseLib::EventTracer::writeChromeTrace(trace_arg.getValue());
+            }
+
 #if defined(USE_PETSC)
             controller->Finalize(1);
 #endif
@@ -8,6 +8,7 @@
  */
 
 // STL
+#include <algorithm>
 #include <cctype>
 #include <iostream>
 #include <limits>
@@ -30,6 +31,7 @@
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/RasterToMesh.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "ParameterLib/StreamedTimeSeriesParameter.h"
 
 using namespace netCDF;
 
@@ -178,7 +180,8 @@ static void flipRaster(std::vector<double>& data, std::size_t const width,
                 std::size_t const height)
 {
     std::size_t const length(data.size());
-    std::vector<double> tmp_vec(length);
+    std::vector<double> tmp_vec;
+    tmp_vec.reserve(length);
     for (std::size_t i = 0; i < height; i++)
     {
         std::size_t const line_idx(length - (width * (i + 1)));
@@ -397,6 +400,15 @@ static std::vector<std::size_t> getLength(NcVar const& var, bool const is_time_d
     return length;
 }
 
+static bool hasNorthwestOrigin(NcFile const& dataset, NcVar const& var)
+{
+    std::size_t const n_dims(var.getDimCount());
+    NcVar const dim_var(getDimVar(dataset, var, n_dims - 1));
+    auto const bounds = (dim_var.isNull()) ? getDimLength(var, n_dims - 1)
+                                           : getBoundaries(dim_var);
+    return bounds.first > bounds.second;
+}
+
 static std::vector<double> getData(NcFile const& dataset, NcVar const& var,
                             std::size_t const total_length,
                             std::size_t const time_step,
@@ -412,10 +424,7 @@ static std::vector<double> getData(NcFile const& dataset, NcVar const& var,
 
     // reverse lines in vertical direction if the original file has its origin
     // in the northwest corner
-    NcVar const dim_var (getDimVar(dataset, var, n_dims - 1));
-    auto const bounds = (dim_var.isNull()) ? getDimLength(var, n_dims - 1)
-                                           : getBoundaries(dim_var);
-    if (bounds.first > bounds.second)
+    if (hasNorthwestOrigin(dataset, var))
         flipRaster(data_vec, length[n_dims - 2], length[n_dims - 1]);
     return data_vec;
 }
@@ -573,6 +582,135 @@ static bool convert(NcFile const& dataset, NcVar const& var,
     return true;
 }
 
+static std::vector<double> getTimes(
+    NcFile const& dataset, NcVar const& var,
+    std::vector<std::size_t> const& dim_idx_map, bool const is_time_dep,
+    std::pair<std::size_t, std::size_t> const& time_bounds)
+{
+    std::size_t const n_time_steps = time_bounds.second - time_bounds.first + 1;
+    std::vector<double> times(n_time_steps);
+    NcVar const time_var = (is_time_dep)
+                               ? getDimVar(dataset, var, dim_idx_map[0])
+                               : NcVar();
+    if (time_var.isNull() || time_var.getDimCount() != 1)
+    {
+        std::iota(times.begin(), times.end(),
+                  static_cast<double>(time_bounds.first));
+    }
+    else
+    {
+        time_var.getVar({time_bounds.first}, {n_time_steps}, times.data());
+    }
+    return times;
+}
+
+/// Converts the selected time steps into one mesh and a single time series
+/// file holding the values of all time steps at the mesh elements, which can
+/// be read by a StreamedTimeSeries parameter. The element layout of the mesh
+/// is determined by the no-data values of the first time step.
+static bool convertToTimeSeries(
+    NcFile const& dataset, NcVar const& var, std::string const& output_name,
+    std::string const& time_series_name,
+    std::vector<std::size_t> const& dim_idx_map, bool const is_time_dep,
+    std::pair<std::size_t, std::size_t> const& time_bounds,
+    MeshLib::MeshElemType const elem_type)
+{
+    std::vector<std::size_t> const length = getLength(var, is_time_dep);
+    std::size_t const array_length = std::accumulate(
+        length.cbegin(), length.cend(), 1, std::multiplies<std::size_t>());
+    GeoLib::RasterHeader const header =
+        createRasterHeader(dataset, var, dim_idx_map, length, is_time_dep);
+
+    // The raster cell of each mesh element is found by converting a raster
+    // holding the cell indices instead of values.
+    std::vector<double> const first_step =
+        getData(dataset, var, array_length, time_bounds.first, length);
+    std::vector<double> cell_ids(array_length);
+    for (std::size_t i = 0; i < array_length; ++i)
+    {
+        cell_ids[i] = (first_step[i] == no_data) ? no_data
+                                                 : static_cast<double>(i);
+    }
+    std::string const cell_ids_name("RasterCellIDs");
+    std::unique_ptr<MeshLib::Mesh> mesh(MeshLib::RasterToMesh::convert(
+        cell_ids.data(), header, elem_type, MeshLib::UseIntensityAs::DATAVECTOR,
+        cell_ids_name));
+    if (mesh == nullptr)
+        return false;
+
+    auto const* const cell_id_vec =
+        mesh->getProperties().getPropertyVector<double>(cell_ids_name);
+    std::vector<std::size_t> element_cells(cell_id_vec->size());
+    std::transform(cell_id_vec->cbegin(), cell_id_vec->cend(),
+                   element_cells.begin(),
+                   [](double const id) { return static_cast<std::size_t>(id); });
+    mesh->getProperties().removePropertyVector(cell_ids_name);
+    std::size_t const n_elements = element_cells.size();
+
+    std::vector<double> first_values(n_elements);
+    for (std::size_t e = 0; e < n_elements; ++e)
+        first_values[e] = first_step[element_cells[e]];
+    MeshLib::addPropertyToMesh<double>(*mesh, var.getName(),
+                                       MeshLib::MeshItemType::Cell, 1,
+                                       first_values);
+    MeshLib::IO::VtuInterface vtu(mesh.get());
+    vtu.writeToFile(output_name);
+
+    std::vector<double> const times =
+        getTimes(dataset, var, dim_idx_map, is_time_dep, time_bounds);
+    ParameterLib::TimeSeriesFileWriter writer(time_series_name, n_elements, 1,
+                                              times);
+
+    // The time steps are read in chunks with one hyperslab request each and
+    // the time steps of a chunk are mapped to the mesh elements in parallel.
+    std::size_t const n_dims(var.getDimCount());
+    bool const flip = hasNorthwestOrigin(dataset, var);
+    std::size_t const n_time_steps = times.size();
+    std::size_t const max_chunk_size = 64;
+    std::vector<double> chunk;
+    std::vector<std::vector<double>> slices;
+    for (std::size_t first = 0; first < n_time_steps; first += max_chunk_size)
+    {
+        std::size_t const chunk_size =
+            std::min(max_chunk_size, n_time_steps - first);
+        std::cout << "Converting time steps " << time_bounds.first + first
+                  << " to " << time_bounds.first + first + chunk_size - 1
+                  << "...\n";
+
+        std::vector<std::size_t> offset(n_dims, 0);
+        std::vector<std::size_t> count(length);
+        if (is_time_dep)
+        {
+            offset[0] = time_bounds.first + first;
+            count[0] = chunk_size;
+        }
+        chunk.resize(chunk_size * array_length);
+        var.getVar(offset, count, chunk.data());
+
+        slices.resize(chunk_size);
+#pragma omp parallel for
+        for (long k = 0; k < static_cast<long>(chunk_size); ++k)
+        {
+            std::vector<double> data_vec(
+                chunk.cbegin() + k * array_length,
+                chunk.cbegin() + (k + 1) * array_length);
+            std::replace_if(data_vec.begin(), data_vec.end(),
+                            [](double& x) { return x <= no_data; }, no_data);
+            if (flip)
+                flipRaster(data_vec, length[n_dims - 2], length[n_dims - 1]);
+
+            auto& slice = slices[k];
+            slice.resize(n_elements);
+            for (std::size_t e = 0; e < n_elements; ++e)
+                slice[e] = data_vec[element_cells[e]];
+        }
+
+        for (std::size_t k = 0; k < chunk_size; ++k)
+            writer.writeSlice(slices[k]);
+    }
+    return true;
+}
+
 int main(int argc, char* argv[])
 {
     ApplicationsLib::LogogSetup logog_setup;
@@ -599,6 +737,14 @@ int main(int argc, char* argv[])
         "one scalar array per time step)");
     cmd.add(arg_single_file);
 
+    TCLAP::ValueArg<std::string> arg_time_series(
+        "", "time-series",
+        "if set, the mesh is written once and the values of all time steps "
+        "are written to this binary time series file, which can be read by a "
+        "StreamedTimeSeries parameter",
+        false, "", "string containing the path and file name");
+    cmd.add(arg_time_series);
+
     TCLAP::ValueArg<std::size_t> arg_time_end(
         "", "timestep-last",
         "last time step to be extracted (only for time-dependent variables!)",
@@ -701,7 +847,11 @@ int main(int argc, char* argv[])
                 : timestepSelectionLoop(var, dim_idx_map[0]);
 
     bool use_single_file(true);
-    if (arg_time_start.isSet() && time_bounds.first != time_bounds.second)
+    if (arg_time_series.isSet())
+    {
+        // all time steps are written to the time series file
+    }
+    else if (arg_time_start.isSet() && time_bounds.first != time_bounds.second)
     {
         use_single_file = arg_single_file.isSet();
     }
@@ -717,8 +867,15 @@ int main(int argc, char* argv[])
                             ? assignElemType(arg_elem_type)
                             : elemSelectionLoop(n_dims - temp_offset);
 
-    if (!convert(dataset, var, output_name, dim_idx_map, is_time_dep,
-                 time_bounds, use_single_file, elem_type))
+    if (arg_time_series.isSet())
+    {
+        if (!convertToTimeSeries(dataset, var, output_name,
+                                 arg_time_series.getValue(), dim_idx_map,
+                                 is_time_dep, time_bounds, elem_type))
+            return EXIT_FAILURE;
+    }
+    else if (!convert(dataset, var, output_name, dim_idx_map, is_time_dep,
+                      time_bounds, use_single_file, elem_type))
         return EXIT_FAILURE;
 
     std::cout << "Conversion finished successfully.\n";
@@ -0,0 +1,161 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "InfoLib/GitInfo.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/ErrorIndicator.h"
+#include "MeshLib/MeshEditing/RefineMeshByBisection.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Refines a mesh of line, triangle and tetrahedral elements where the "
+        "gradient of a nodal field is large, e.g. at moving fronts of a "
+        "previous simulation result. The elements with a gradient error "
+        "indicator above the given fraction of the maximal indicator are "
+        "refined by longest edge bisection keeping the mesh conforming. Nodal "
+        "fields are interpolated linearly, cell and integration point data "
+        "are copied from the parent elements. Optionally, elements of a "
+        "previous refinement with a small indicator are coarsened. The "
+        "refined mesh is meant as input of a new simulation; it is not "
+        "adapted during a simulation.\n\n"
+        "OpenGeoSys-6 software, version " +
+            GitInfoLib::GitInfo::ogs_version +
+            ".\n"
+            "Copyright (c) 2012-2020, OpenGeoSys Community "
+            "(http://www.opengeosys.org)",
+        ' ', GitInfoLib::GitInfo::ogs_version);
+
+    TCLAP::ValueArg<unsigned> cycles_arg(
+        "n", "cycles", "number of refinement cycles (default 1)", false, 1,
+        "number");
+    cmd.add(cycles_arg);
+    TCLAP::ValueArg<double> theta_arg(
+        "t", "theta",
+        "elements with an error indicator of at least theta times the maximal "
+        "indicator are refined (default 0.5)",
+        false, 0.5, "number in [0, 1]");
+    cmd.add(theta_arg);
+    TCLAP::ValueArg<double> coarsening_theta_arg(
+        "k", "coarsening-theta",
+        "elements of a previous refinement with an error indicator of at most "
+        "the given fraction of the maximal indicator are coarsened before the "
+        "refinement (default: no coarsening)",
+        false, 0, "number in [0, theta)");
+    cmd.add(coarsening_theta_arg);
+    TCLAP::ValueArg<int> component_arg(
+        "c", "component", "component of the nodal field (default 0)", false,
+        0, "number");
+    cmd.add(component_arg);
+    TCLAP::ValueArg<std::string> property_arg(
+        "p", "property", "name of the nodal field of type double", true, "",
+        "string");
+    cmd.add(property_arg);
+    TCLAP::ValueArg<std::string> output_arg(
+        "o", "output-mesh-file", "output mesh file", true, "", "string");
+    cmd.add(output_arg);
+    TCLAP::ValueArg<std::string> input_arg(
+        "i", "input-mesh-file", "input mesh file", true, "", "string");
+    cmd.add(input_arg);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::IO::readMeshFromFile(input_arg.getValue()));
+    if (!mesh)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (coarsening_theta_arg.isSet() &&
+        coarsening_theta_arg.getValue() >= theta_arg.getValue())
+    {
+        ERR("The coarsening fraction must be smaller than the refinement "
+            "fraction %g.",
+            theta_arg.getValue());
+        return EXIT_FAILURE;
+    }
+
+    auto const& property_name = property_arg.getValue();
+    int const component = component_arg.getValue();
+    auto compute_indicator = [&](MeshLib::Mesh const& mesh)
+        -> boost::optional<std::vector<double>> {
+        if (!mesh.getProperties().existsPropertyVector<double>(property_name))
+        {
+            ERR("The mesh has no nodal field '%s' of type double.",
+                property_name.c_str());
+            return boost::none;
+        }
+        auto const& field =
+            *mesh.getProperties().getPropertyVector<double>(property_name);
+        if (field.getMeshItemType() != MeshLib::MeshItemType::Node ||
+            component < 0 || component >= field.getNumberOfComponents())
+        {
+            ERR("The property '%s' is not a nodal field with component %d.",
+                property_name.c_str(), component);
+            return boost::none;
+        }
+
+        std::vector<double> values(mesh.getNumberOfNodes());
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = field.getComponent(i, component);
+        }
+        return MeshLib::computeGradientErrorIndicator(mesh, values);
+    };
+
+    for (unsigned cycle = 0; cycle < cycles_arg.getValue(); ++cycle)
+    {
+        auto indicator = compute_indicator(*mesh);
+        if (!indicator)
+        {
+            return EXIT_FAILURE;
+        }
+
+        if (coarsening_theta_arg.isSet())
+        {
+            auto const marked_elements = MeshLib::markElementsForCoarsening(
+                *indicator, coarsening_theta_arg.getValue());
+            INFO("Coarsening cycle %d: %d of %d elements marked.", cycle,
+                 marked_elements.size(), mesh->getNumberOfElements());
+            mesh = MeshLib::coarsenBisectedMesh(*mesh, marked_elements,
+                                                mesh->getName());
+            indicator = compute_indicator(*mesh);
+        }
+
+        auto const marked_elements =
+            MeshLib::markElementsForRefinement(*indicator, theta_arg.getValue());
+        INFO("Refinement cycle %d: %d of %d elements marked.", cycle,
+             marked_elements.size(), mesh->getNumberOfElements());
+        if (marked_elements.empty())
+        {
+            break;
+        }
+        mesh = MeshLib::refineMeshByBisection(*mesh, marked_elements,
+                                              mesh->getName());
+    }
+
+    INFO("Save the refined mesh with %d nodes and %d elements.",
+         mesh->getNumberOfNodes(), mesh->getNumberOfElements());
+    MeshLib::IO::writeMeshToFile(*mesh, output_arg.getValue());
+
+    return EXIT_SUCCESS;
+}
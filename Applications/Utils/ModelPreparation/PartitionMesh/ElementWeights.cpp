@@ -0,0 +1,158 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ElementWeights.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Mesh.h"
+
+namespace ApplicationUtils
+{
+std::vector<double> readElementCostsFromProperty(
+    MeshLib::Mesh const& mesh, std::string const& property_name)
+{
+    auto const& properties = mesh.getProperties();
+    if (properties.existsPropertyVector<double>(
+            property_name, MeshLib::MeshItemType::Cell, 1))
+    {
+        auto const& costs = *properties.getPropertyVector<double>(
+            property_name, MeshLib::MeshItemType::Cell, 1);
+        return {costs.begin(), costs.end()};
+    }
+    if (properties.existsPropertyVector<int>(property_name,
+                                             MeshLib::MeshItemType::Cell, 1))
+    {
+        auto const& costs = *properties.getPropertyVector<int>(
+            property_name, MeshLib::MeshItemType::Cell, 1);
+        return {costs.begin(), costs.end()};
+    }
+
+    OGS_FATAL(
+        "The mesh '%s' has no scalar cell property '%s' of type double or int "
+        "for the element weights.",
+        mesh.getName().c_str(), property_name.c_str());
+}
+
+std::vector<double> readElementCostProfile(std::string const& file_name,
+                                           std::size_t const number_of_elements)
+{
+    std::ifstream is(file_name);
+    if (!is.is_open())
+    {
+        OGS_FATAL("Error: cannot open the element cost profile %s.",
+                  file_name.c_str());
+    }
+
+    std::vector<double> costs(number_of_elements,
+                              std::numeric_limits<double>::quiet_NaN());
+    std::string line;
+    std::size_t line_number = 0;
+    while (std::getline(is, line))
+    {
+        line_number++;
+        auto const first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream line_stream(line);
+        std::size_t element_id;
+        double cost;
+        if (!(line_stream >> element_id >> cost))
+        {
+            OGS_FATAL(
+                "Error: could not read element id and cost in line %d of the "
+                "element cost profile %s.",
+                line_number, file_name.c_str());
+        }
+        if (element_id >= number_of_elements)
+        {
+            OGS_FATAL(
+                "Error: the element id %d in line %d of the element cost "
+                "profile %s exceeds the number of elements %d.",
+                element_id, line_number, file_name.c_str(),
+                number_of_elements);
+        }
+        costs[element_id] = cost;
+    }
+
+    auto const missing = std::find_if(costs.begin(), costs.end(),
+                                      [](double c) { return std::isnan(c); });
+    if (missing != costs.end())
+    {
+        OGS_FATAL(
+            "Error: the element cost profile %s contains no cost for the "
+            "element %d.",
+            file_name.c_str(), std::distance(costs.begin(), missing));
+    }
+
+    return costs;
+}
+
+std::vector<long> computeMetisElementWeights(
+    std::vector<double> const& element_costs)
+{
+    if (element_costs.empty())
+    {
+        return {};
+    }
+
+    for (auto const cost : element_costs)
+    {
+        if (!std::isfinite(cost) || cost < 0)
+        {
+            OGS_FATAL("Error: the element costs must be non-negative, got %g.",
+                      cost);
+        }
+    }
+    double const max_cost =
+        *std::max_element(element_costs.begin(), element_costs.end());
+    if (max_cost == 0)
+    {
+        OGS_FATAL("Error: all element costs are zero.");
+    }
+
+    // The weights range from 1 to the resolution. METIS uses 32 bit integers
+    // by default; the resolution is reduced for very large meshes such that
+    // the total weight does not overflow.
+    long const resolution = std::min<long>(
+        100, std::numeric_limits<std::int32_t>::max() / element_costs.size());
+    if (resolution < 1)
+    {
+        OGS_FATAL("Error: too many elements (%d) for weighted partitioning.",
+                  element_costs.size());
+    }
+
+    std::vector<long> weights(element_costs.size());
+    std::transform(element_costs.begin(), element_costs.end(), weights.begin(),
+                   [&](double const cost) {
+                       return std::max(
+                           1L, std::lround(cost / max_cost * resolution));
+                   });
+
+    auto const minmax = std::minmax_element(weights.begin(), weights.end());
+    INFO("Element weights: min %ld, max %ld, total %ld.", *minmax.first,
+         *minmax.second, std::accumulate(weights.begin(), weights.end(), 0L));
+
+    return weights;
+}
+}  // namespace ApplicationUtils
@@ -0,0 +1,42 @@
+/**
+ * \file
+ *
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace ApplicationUtils
+{
+/// Reads the computational costs of the elements from a cell property of the
+/// mesh. The property must be a scalar of type double or int.
+std::vector<double> readElementCostsFromProperty(
+    MeshLib::Mesh const& mesh, std::string const& property_name);
+
+/// Reads the computational costs of the elements from a user supplied cost
+/// profile; ogs itself does not record costs per element. Each line of the
+/// file contains an element id and the cost of the element; empty lines and
+/// lines starting with '#' are skipped. Each element must be listed.
+std::vector<double> readElementCostProfile(std::string const& file_name,
+                                           std::size_t number_of_elements);
+
+/// Converts the element costs into the positive integer element weights
+/// required by METIS. The costs are scaled relative to the most expensive
+/// element such that the sum of the weights fits into a 32 bit integer.
+std::vector<long> computeMetisElementWeights(
+    std::vector<double> const& element_costs);
+
+}  // namespace ApplicationUtils
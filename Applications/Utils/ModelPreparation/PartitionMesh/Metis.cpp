@@ -17,8 +17,18 @@
 namespace ApplicationUtils
 {
 void writeMETIS(std::vector<MeshLib::Element*> const& elements,
-                const std::string& file_name)
+                const std::string& file_name,
+                std::vector<long> const& element_weights)
 {
+    bool const has_weights = !element_weights.empty();
+    if (has_weights && element_weights.size() != elements.size())
+    {
+        OGS_FATAL(
+            "Error: the number of element weights %d differs from the number "
+            "of elements %d.",
+            element_weights.size(), elements.size());
+    }
+
     std::ofstream os(file_name, std::ios::trunc);
     if (!os.is_open())
     {
@@ -30,9 +40,15 @@ void writeMETIS(std::vector<MeshLib::Element*> const& elements,
         OGS_FATAL("Error: Cannot write in file %s.", file_name.data());
     }
 
-    os << elements.size() << " \n";
-    for (const auto* elem : elements)
+    // With weights the header contains the number of weights per element.
+    os << elements.size() << (has_weights ? " 1" : "") << " \n";
+    for (std::size_t i = 0; i < elements.size(); i++)
     {
+        auto const* elem = elements[i];
+        if (has_weights)
+        {
+            os << element_weights[i] << " ";
+        }
         os << elem->getNodeIndex(0) + 1;
         for (unsigned j = 1; j < elem->getNumberOfNodes(); j++)
         {
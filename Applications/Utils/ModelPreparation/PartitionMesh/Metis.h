@@ -24,8 +24,12 @@ namespace ApplicationUtils
 /// Write elements as METIS graph file
 /// \param elements The mesh elements.
 /// \param file_name File name with an extension of mesh.
+/// \param element_weights Optional element weights, which are written in
+///                        front of the node ids of each element. The weights
+///                        are used by mpmetis only for the dual graph.
 void writeMETIS(std::vector<MeshLib::Element*> const& elements,
-                const std::string& file_name);
+                const std::string& file_name,
+                std::vector<long> const& element_weights = {});
 
 /// Read metis data
 /// \param file_name_base The prefix of the filename.
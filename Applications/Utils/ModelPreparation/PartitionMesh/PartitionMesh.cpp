@@ -27,6 +27,7 @@
 #include "BaseLib/RunTime.h"
 #include "MeshLib/IO/readMeshFromFile.h"
 
+#include "ElementWeights.h"
 #include "Metis.h"
 #include "NodeWiseMeshPartitioner.h"
 
@@ -84,6 +85,24 @@ int main(int argc, char* argv[])
     TCLAP::SwitchArg ascii_flag("a", "ascii", "Enable ASCII output.", false);
     cmd.add(ascii_flag);
 
+    TCLAP::ValueArg<std::string> element_weights_arg(
+        "", "element_weights",
+        "name of a scalar cell property of the input mesh containing the "
+        "computational costs of the elements. The costs are passed to METIS as "
+        "element weights to balance the load of the partitions.",
+        false, "", "property name");
+    cmd.add(element_weights_arg);
+
+    TCLAP::ValueArg<std::string> element_cost_profile_arg(
+        "", "element_cost_profile",
+        "file containing user supplied computational costs of the elements, "
+        "e.g., estimated from the element types or the local physics. Each "
+        "line consists of an element id and the cost of the element. The "
+        "costs are passed to METIS as element weights to balance the load of "
+        "the partitions.",
+        false, "", "file name");
+    cmd.add(element_cost_profile_arg);
+
     // All the remaining arguments are used as file names for boundary/subdomain
     // meshes.
     TCLAP::UnlabeledMultiArg<std::string> other_meshes_filenames_arg(
@@ -106,11 +125,56 @@ int main(int argc, char* argv[])
          mesh_ptr->getNumberOfNodes(),
          mesh_ptr->getNumberOfElements());
 
+    if (element_weights_arg.isSet() && element_cost_profile_arg.isSet())
+    {
+        OGS_FATAL(
+            "The element weights can be given either by a mesh property or by "
+            "a cost profile, but not both.");
+    }
+    std::vector<double> element_costs;
+    if (element_weights_arg.isSet())
+    {
+        INFO("Read element costs from the cell property '%s'.",
+             element_weights_arg.getValue().c_str());
+        element_costs = readElementCostsFromProperty(
+            *mesh_ptr, element_weights_arg.getValue());
+    }
+    if (element_cost_profile_arg.isSet())
+    {
+        INFO("Read element costs from the file '%s'.",
+             element_cost_profile_arg.getValue().c_str());
+        element_costs = readElementCostProfile(
+            element_cost_profile_arg.getValue(),
+            mesh_ptr->getNumberOfElements());
+    }
+    auto const element_weights = computeMetisElementWeights(element_costs);
+
+    // The weighted METIS input is written into a separate file in the output
+    // directory, which is partitioned on the dual graph because mpmetis
+    // ignores the element weights for the nodal graph. The node partitioning
+    // is derived by METIS from the element partitioning.
+    bool const is_weighted = !element_weights.empty();
+    std::string const metis_file_name_wo_extension =
+        is_weighted
+            ? BaseLib::joinPaths(output_directory_arg.getValue(),
+                                 BaseLib::extractBaseNameWithoutExtension(
+                                     mesh_input.getValue()) +
+                                     "_weighted")
+            : input_file_name_wo_extension;
+    std::string const metis_graph_type = is_weighted ? "dual" : "nodal";
+
     if (ogs2metis_flag.getValue())
     {
         INFO("Write the mesh into METIS input file.");
         ApplicationUtils::writeMETIS(mesh_ptr->getElements(),
-                                     input_file_name_wo_extension + ".mesh");
+                                     metis_file_name_wo_extension + ".mesh",
+                                     element_weights);
+        if (is_weighted)
+        {
+            INFO(
+                "The element weights are used by mpmetis only with the option "
+                "-gtype=dual.");
+        }
         INFO("Total runtime: %g s.", run_timer.elapsed());
         INFO("Total CPU time: %g s.", CPU_timer.elapsed());
 
@@ -141,14 +205,23 @@ int main(int argc, char* argv[])
     // Execute mpmetis via system(...)
     if (exe_metis_flag.getValue())
     {
+        if (is_weighted)
+        {
+            INFO("Write the mesh with element weights into METIS input file.");
+            ApplicationUtils::writeMETIS(
+                mesh_partitioner.mesh().getElements(),
+                metis_file_name_wo_extension + ".mesh", element_weights);
+        }
+
         INFO("METIS is running ...");
         const std::string exe_name = argv[0];
         const std::string exe_path = BaseLib::extractPath(exe_name);
         INFO("Path to mpmetis is: \n\t%s", exe_path.c_str());
 
         const std::string mpmetis_com =
-            BaseLib::joinPaths(exe_path, "mpmetis") + " -gtype=nodal " + "'" +
-            input_file_name_wo_extension + ".mesh" + "' " +
+            BaseLib::joinPaths(exe_path, "mpmetis") +
+            " -gtype=" + metis_graph_type + " '" +
+            metis_file_name_wo_extension + ".mesh" + "' " +
             std::to_string(nparts.getValue());
 
         const int status = system(mpmetis_com.c_str());
@@ -160,10 +233,10 @@ int main(int argc, char* argv[])
         }
     }
     mesh_partitioner.resetPartitionIdsForNodes(
-        readMetisData(input_file_name_wo_extension, num_partitions,
+        readMetisData(metis_file_name_wo_extension, num_partitions,
                       mesh_partitioner.mesh().getNumberOfNodes()));
 
-    removeMetisPartitioningFiles(input_file_name_wo_extension, num_partitions);
+    removeMetisPartitioningFiles(metis_file_name_wo_extension, num_partitions);
 
     INFO("Partitioning the mesh in the node wise way ...");
     bool const is_mixed_high_order_linear_elems = lh_elems_flag.getValue();
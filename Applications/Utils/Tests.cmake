@@ -187,6 +187,28 @@ AddTest(
               2Dmesh_POINT5_partitioned_node_properties_val3.bin
 )
 
+# Weighted partitioning; checks only that the weighted METIS input is written
+# and partitioned on the dual graph.
+AddTest(
+    NAME partmesh_element_weights_property
+    PATH Parabolic/HT/StaggeredCoupling/ADecovalexTHMCBasedHTExample
+    EXECUTABLE partmesh
+    EXECUTABLE_ARGS -m -n 2 -i th_decovalex.vtu --element_weights MaterialIDs
+                    -o ${Data_BINARY_DIR}/Parabolic/HT/StaggeredCoupling/ADecovalexTHMCBasedHTExample
+    REQUIREMENTS NOT OGS_USE_MPI
+)
+
+AddTest(
+    NAME partmesh_element_weights_cost_profile
+    PATH NodePartitionedMesh/partmesh_element_weights
+    EXECUTABLE partmesh
+    EXECUTABLE_ARGS -m -n 3
+                    -i ${Data_SOURCE_DIR}/NodePartitionedMesh/partmesh_2Dmesh_3partitions/ASCII/2Dmesh.vtu
+                    --element_cost_profile 2Dmesh_costs.txt
+                    -o ${Data_BINARY_DIR}/NodePartitionedMesh/partmesh_element_weights
+    REQUIREMENTS NOT OGS_USE_MPI
+)
+
 # Regression test for https://github.com/ufz/ogs/issues/1845 fixed in
 # https://github.com/ufz/ogs/pull/2237
 # checkMesh crashed when encountered Line3 element.
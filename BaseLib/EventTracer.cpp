@@ -0,0 +1,208 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "EventTracer.h"
+
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#if defined(USE_MPI)
+#include <mpi.h>
+#endif
+
+#include <logog/include/logog.hpp>
+
+#include "Error.h"
+
+namespace
+{
+struct Event
+{
+    char const* name;
+    char const* category;
+    BaseLib::EventTracer::Clock::time_point begin;
+    BaseLib::EventTracer::Clock::time_point end;
+};
+
+struct ThreadBuffer
+{
+    explicit ThreadBuffer(int const thread_id_) : thread_id(thread_id_)
+    {
+        events.reserve(4096);
+    }
+
+    int const thread_id;
+    std::vector<Event> events;
+};
+
+/// The buffers are owned here, such that the events of threads which ended
+/// before the export are kept.
+std::mutex buffers_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+BaseLib::EventTracer::Clock::time_point origin;
+
+thread_local ThreadBuffer* thread_buffer = nullptr;
+
+ThreadBuffer& getThreadBuffer()
+{
+    if (thread_buffer == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        buffers.push_back(
+            std::make_unique<ThreadBuffer>(static_cast<int>(buffers.size())));
+        thread_buffer = buffers.back().get();
+    }
+    return *thread_buffer;
+}
+
+bool isMPIInitialized()
+{
+#if defined(USE_MPI)
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    return initialized != 0;
+#else
+    return false;
+#endif
+}
+
+/// Serializes the events of this rank, each followed by a comma and a line
+/// break.
+std::string serializeEvents(int const rank)
+{
+    auto const microseconds =
+        [](BaseLib::EventTracer::Clock::duration const d) {
+            return std::chrono::duration<double, std::micro>(d).count();
+        };
+
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+       << ",\"tid\":0,\"args\":{\"name\":\"rank " << rank << "\"}},\n";
+
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    for (auto const& buffer : buffers)
+    {
+        os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << rank
+           << ",\"tid\":" << buffer->thread_id
+           << ",\"args\":{\"name\":\"thread " << buffer->thread_id
+           << "\"}},\n";
+        for (auto const& event : buffer->events)
+        {
+            os << "{\"name\":\"" << event.name << "\",\"cat\":\""
+               << event.category << "\",\"ph\":\"X\",\"ts\":"
+               << microseconds(event.begin - origin)
+               << ",\"dur\":" << microseconds(event.end - event.begin)
+               << ",\"pid\":" << rank << ",\"tid\":" << buffer->thread_id
+               << "},\n";
+        }
+    }
+    return os.str();
+}
+}  // namespace
+
+namespace BaseLib
+{
+std::atomic<bool> EventTracer::_enabled{false};
+
+void EventTracer::enable()
+{
+#if defined(USE_MPI)
+    // A common origin of the timelines of all ranks.
+    if (isMPIInitialized())
+    {
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+#endif
+    origin = Clock::now();
+    _enabled.store(true);
+}
+
+void EventTracer::disable()
+{
+    _enabled.store(false);
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    for (auto& buffer : buffers)
+    {
+        buffer->events.clear();
+    }
+}
+
+void EventTracer::record(char const* const name, char const* const category,
+                         Clock::time_point const begin,
+                         Clock::time_point const end)
+{
+    getThreadBuffer().events.push_back({name, category, begin, end});
+}
+
+void EventTracer::writeChromeTrace(std::string const& file_name)
+{
+    int rank = 0;
+    std::string events;
+    if (!isMPIInitialized())
+    {
+        events = serializeEvents(rank);
+    }
+#if defined(USE_MPI)
+    else
+    {
+        int size = 1;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+        std::string const rank_events = serializeEvents(rank);
+        int const length = static_cast<int>(rank_events.size());
+        std::vector<int> lengths(size);
+        MPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0,
+                   MPI_COMM_WORLD);
+
+        std::vector<int> offsets(size, 0);
+        for (int i = 1; i < size; ++i)
+        {
+            offsets[i] = offsets[i - 1] + lengths[i - 1];
+        }
+        if (rank == 0)
+        {
+            events.resize(offsets.back() + lengths.back());
+        }
+        MPI_Gatherv(rank_events.data(), length, MPI_CHAR, events.data(),
+                    lengths.data(), offsets.data(), MPI_CHAR, 0,
+                    MPI_COMM_WORLD);
+    }
+#endif
+
+    if (rank != 0)
+    {
+        return;
+    }
+
+    // Drop the separator after the last event.
+    events.resize(events.size() - 2);
+
+    std::ofstream os(file_name);
+    if (!os)
+    {
+        OGS_FATAL("Could not open the trace file `%s' for writing.",
+                  file_name.c_str());
+    }
+    os << "{\"traceEvents\":[\n"
+       << events << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    if (!os)
+    {
+        OGS_FATAL("Could not write the trace file `%s'.", file_name.c_str());
+    }
+    INFO("Wrote the event trace to `%s'.", file_name.c_str());
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,94 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace BaseLib
+{
+/// Records the begin and end of named events, e.g. time steps, assembly or
+/// linear solves, for a timeline of the run, which can be inspected with
+/// standard trace viewers like chrome://tracing or Perfetto.
+///
+/// The events are buffered per thread without locking. After the run they
+/// are exported in the Chrome trace event format, where each MPI rank is
+/// shown as a process and each thread as a thread of that process.
+///
+/// If the tracer is not enabled, recording an event reduces to a check of
+/// a flag.
+class EventTracer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Starts recording. The time of the call is the origin of the timeline.
+    /// In parallel runs all ranks have to call this function.
+    static void enable();
+
+    /// Stops recording and discards the events recorded so far.
+    static void disable();
+
+    static bool isEnabled()
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Adds an event to the buffer of the calling thread. The strings are not
+    /// copied and must outlive the tracer, i.e., they should be literals.
+    static void record(char const* const name, char const* const category,
+                       Clock::time_point const begin,
+                       Clock::time_point const end);
+
+    /// Writes all recorded events as Chrome trace JSON. In parallel runs the
+    /// events of all ranks are collected and written by rank 0; all ranks
+    /// have to call this function. No events may be recorded concurrently.
+    static void writeChromeTrace(std::string const& file_name);
+
+private:
+    static std::atomic<bool> _enabled;
+};
+
+/// Records an event lasting from the construction to the destruction of the
+/// object, if the EventTracer is enabled.
+class TraceScope final
+{
+public:
+    TraceScope(char const* const name, char const* const category)
+        : _name(name), _category(category), _enabled(EventTracer::isEnabled())
+    {
+        if (_enabled)
+        {
+            _begin = EventTracer::Clock::now();
+        }
+    }
+
+    TraceScope(TraceScope const&) = delete;
+    TraceScope& operator=(TraceScope const&) = delete;
+
+    ~TraceScope()
+    {
+        if (_enabled)
+        {
+            EventTracer::record(_name, _category, _begin,
+                                EventTracer::Clock::now());
+        }
+    }
+
+private:
+    char const* const _name;
+    char const* const _category;
+    bool const _enabled;
+    EventTracer::Clock::time_point _begin;
+};
+
+}  // namespace BaseLib
@@ -0,0 +1,127 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MemoryAccounting.h"
+
+#include <mutex>
+#include <numeric>
+
+#include <logog/include/logog.hpp>
+
+#include "MemWatch.h"
+
+namespace
+{
+std::mutex accounting_mutex;
+BaseLib::MemoryAccounting::Breakdown current_usage{};
+BaseLib::MemoryAccounting::Breakdown peak_usage{};
+std::size_t current_total = 0;
+std::size_t peak_total = 0;
+
+double toMiB(std::size_t const bytes)
+{
+    return static_cast<double>(bytes) / (1024. * 1024.);
+}
+
+std::size_t sum(BaseLib::MemoryAccounting::Breakdown const& usage)
+{
+    return std::accumulate(usage.begin(), usage.end(), std::size_t{0});
+}
+
+void printBreakdown(BaseLib::MemoryAccounting::Breakdown const& usage)
+{
+    for (std::size_t i = 0; i < BaseLib::number_of_memory_tags; ++i)
+    {
+        INFO("[memory]   %-24s %10.1f MiB",
+             BaseLib::getMemoryTagName(static_cast<BaseLib::MemoryTag>(i)),
+             toMiB(usage[i]));
+    }
+}
+}  // namespace
+
+namespace BaseLib
+{
+char const* getMemoryTagName(MemoryTag const tag)
+{
+    switch (tag)
+    {
+        case MemoryTag::Mesh:
+            return "mesh";
+        case MemoryTag::DOFTables:
+            return "DOF tables";
+        case MemoryTag::SparsityPattern:
+            return "sparsity pattern";
+        case MemoryTag::GlobalMatrices:
+            return "global matrices";
+        case MemoryTag::Factorizations:
+            return "factorizations";
+        case MemoryTag::IntegrationPointData:
+            return "integration point data";
+        case MemoryTag::OutputBuffers:
+            return "output buffers";
+    }
+    return "unknown";
+}
+
+void MemoryAccounting::add(MemoryTag const tag, std::size_t const bytes)
+{
+    std::lock_guard<std::mutex> lock(accounting_mutex);
+    current_usage[static_cast<std::size_t>(tag)] += bytes;
+    current_total += bytes;
+    if (current_total > peak_total)
+    {
+        peak_total = current_total;
+        peak_usage = current_usage;
+    }
+}
+
+void MemoryAccounting::remove(MemoryTag const tag, std::size_t const bytes)
+{
+    std::lock_guard<std::mutex> lock(accounting_mutex);
+    current_usage[static_cast<std::size_t>(tag)] -= bytes;
+    current_total -= bytes;
+}
+
+MemoryAccounting::Breakdown MemoryAccounting::getCurrentUsage()
+{
+    std::lock_guard<std::mutex> lock(accounting_mutex);
+    return current_usage;
+}
+
+MemoryAccounting::Breakdown MemoryAccounting::getPeakUsage()
+{
+    std::lock_guard<std::mutex> lock(accounting_mutex);
+    return peak_usage;
+}
+
+void MemoryAccounting::printCurrentUsage(std::string const& when)
+{
+    auto const usage = getCurrentUsage();
+    INFO("[memory] Tracked memory usage %s: %.1f MiB.", when.c_str(),
+         toMiB(sum(usage)));
+    printBreakdown(usage);
+
+    auto const resident = MemWatch().getResMemUsage();
+    if (resident > 0)
+    {
+        INFO("[memory] Resident memory of the process: %.1f MiB.",
+             toMiB(resident));
+    }
+}
+
+void MemoryAccounting::printPeakUsage()
+{
+    auto const usage = getPeakUsage();
+    INFO("[memory] Peak of the tracked memory usage: %.1f MiB.",
+         toMiB(sum(usage)));
+    printBreakdown(usage);
+}
+
+}  // namespace BaseLib
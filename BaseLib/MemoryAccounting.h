@@ -0,0 +1,175 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace BaseLib
+{
+/// The subsystems the memory usage is accounted for.
+enum class MemoryTag
+{
+    Mesh,
+    DOFTables,
+    SparsityPattern,
+    GlobalMatrices,
+    Factorizations,
+    IntegrationPointData,
+    OutputBuffers
+};
+
+constexpr std::size_t number_of_memory_tags = 7;
+
+char const* getMemoryTagName(MemoryTag const tag);
+
+/// Accounts the memory usage of the main data structures per subsystem.
+///
+/// The usage is reported by counting allocators of containers, see
+/// CountingAllocator, or by objects holding a TrackedMemory. Besides the
+/// current usage, the breakdown at the peak of the total tracked usage is
+/// kept. All functions are thread-safe.
+class MemoryAccounting
+{
+public:
+    using Breakdown = std::array<std::size_t, number_of_memory_tags>;
+
+    static void add(MemoryTag const tag, std::size_t const bytes);
+    static void remove(MemoryTag const tag, std::size_t const bytes);
+
+    static Breakdown getCurrentUsage();
+    static Breakdown getPeakUsage();
+
+    /// Logs the current usage per subsystem, e.g., after the initialization.
+    static void printCurrentUsage(std::string const& when);
+    /// Logs the usage per subsystem at the peak of the total tracked usage.
+    static void printPeakUsage();
+};
+
+/// Memory usage of one object, e.g., a mesh or a factorization, reported
+/// explicitly. The usage is removed from the accounting on destruction.
+class TrackedMemory final
+{
+public:
+    explicit TrackedMemory(MemoryTag const tag) : _tag(tag) {}
+
+    TrackedMemory(TrackedMemory const& other) : _tag(other._tag)
+    {
+        set(other._bytes);
+    }
+
+    TrackedMemory(TrackedMemory&& other) noexcept
+        : _tag(other._tag), _bytes(other._bytes)
+    {
+        other._bytes = 0;
+    }
+
+    TrackedMemory& operator=(TrackedMemory const& other)
+    {
+        set(other._bytes);
+        return *this;
+    }
+
+    TrackedMemory& operator=(TrackedMemory&& other) noexcept
+    {
+        if (this != &other)
+        {
+            set(other._bytes);
+            other.set(0);
+        }
+        return *this;
+    }
+
+    ~TrackedMemory() { set(0); }
+
+    /// Replaces the reported usage by \c bytes.
+    void set(std::size_t const bytes)
+    {
+        if (bytes > _bytes)
+        {
+            MemoryAccounting::add(_tag, bytes - _bytes);
+        }
+        else if (bytes < _bytes)
+        {
+            MemoryAccounting::remove(_tag, _bytes - bytes);
+        }
+        _bytes = bytes;
+    }
+
+    std::size_t bytes() const { return _bytes; }
+
+private:
+    MemoryTag const _tag;
+    std::size_t _bytes = 0;
+};
+
+/// Allocator adaptor accounting all allocations of a container to \c Tag.
+/// The allocations are forwarded to \c BaseAllocator.
+template <typename T, MemoryTag Tag,
+          typename BaseAllocator = std::allocator<T>>
+class CountingAllocator : public BaseAllocator
+{
+    using Traits = std::allocator_traits<BaseAllocator>;
+
+public:
+    using value_type = T;
+    using size_type = typename Traits::size_type;
+    using pointer = typename Traits::pointer;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = CountingAllocator<
+            U, Tag, typename Traits::template rebind_alloc<U>>;
+    };
+
+    CountingAllocator() = default;
+
+    template <typename U, typename OtherBaseAllocator>
+    CountingAllocator(  // NOLINT(google-explicit-constructor)
+        CountingAllocator<U, Tag, OtherBaseAllocator> const& other)
+        : BaseAllocator(static_cast<OtherBaseAllocator const&>(other))
+    {
+    }
+
+    pointer allocate(size_type const n)
+    {
+        auto const p = Traits::allocate(*this, n);
+        MemoryAccounting::add(Tag, n * sizeof(T));
+        return p;
+    }
+
+    void deallocate(pointer const p, size_type const n)
+    {
+        MemoryAccounting::remove(Tag, n * sizeof(T));
+        Traits::deallocate(*this, p, n);
+    }
+};
+
+template <typename T, typename U, MemoryTag Tag, typename BaseT,
+          typename BaseU>
+bool operator==(CountingAllocator<T, Tag, BaseT> const& a,
+                CountingAllocator<U, Tag, BaseU> const& b)
+{
+    return static_cast<BaseT const&>(a) == static_cast<BaseU const&>(b);
+}
+
+template <typename T, typename U, MemoryTag Tag, typename BaseT,
+          typename BaseU>
+bool operator!=(CountingAllocator<T, Tag, BaseT> const& a,
+                CountingAllocator<U, Tag, BaseU> const& b)
+{
+    return !(a == b);
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,314 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+
+#include <Eigen/Core>
+
+namespace MathLib
+{
+/// Dual number for forward mode automatic differentiation.
+///
+/// Carries a value and its derivatives with respect to \c N independent
+/// variables. The derivatives are stored in a fixed size Eigen vector such
+/// that all \c N partial derivatives are propagated in one vectorized pass.
+///
+/// Mathematical functions are found via argument dependent lookup, i.e., code
+/// to be evaluated with dual numbers should call, e.g., \c exp(x) after
+/// <tt>using std::exp;</tt> instead of \c std::exp(x).
+template <int N>
+class DualNumber
+{
+    static_assert(N > 0, "The number of derivatives must be positive.");
+
+public:
+    using Derivatives = Eigen::Matrix<double, N, 1>;
+
+    DualNumber() : _value(0.0), _derivatives(Derivatives::Zero()) {}
+
+    /// Constant w.r.t. all independent variables.
+    DualNumber(double const value)  // NOLINT(google-explicit-constructor)
+        : _value(value), _derivatives(Derivatives::Zero())
+    {
+    }
+
+    DualNumber(double const value, Derivatives const& derivatives)
+        : _value(value), _derivatives(derivatives)
+    {
+    }
+
+    /// Creates the \c i-th independent variable with derivative \c seed.
+    static DualNumber variable(double const value, int const i,
+                               double const seed = 1.0)
+    {
+        DualNumber x(value);
+        x._derivatives[i] = seed;
+        return x;
+    }
+
+    double value() const { return _value; }
+    Derivatives const& derivatives() const { return _derivatives; }
+
+    DualNumber& operator+=(DualNumber const& y)
+    {
+        _value += y._value;
+        _derivatives += y._derivatives;
+        return *this;
+    }
+
+    DualNumber& operator-=(DualNumber const& y)
+    {
+        _value -= y._value;
+        _derivatives -= y._derivatives;
+        return *this;
+    }
+
+    DualNumber& operator*=(DualNumber const& y)
+    {
+        _derivatives = y._value * _derivatives + _value * y._derivatives;
+        _value *= y._value;
+        return *this;
+    }
+
+    DualNumber& operator/=(DualNumber const& y)
+    {
+        double const inv = 1.0 / y._value;
+        _value *= inv;
+        _derivatives = (_derivatives - _value * y._derivatives) * inv;
+        return *this;
+    }
+
+private:
+    double _value;
+    Derivatives _derivatives;
+};
+
+template <int N>
+DualNumber<N> operator-(DualNumber<N> const& x)
+{
+    return {-x.value(), -x.derivatives()};
+}
+
+template <int N>
+DualNumber<N> operator+(DualNumber<N> x, DualNumber<N> const& y)
+{
+    return x += y;
+}
+
+template <int N>
+DualNumber<N> operator-(DualNumber<N> x, DualNumber<N> const& y)
+{
+    return x -= y;
+}
+
+template <int N>
+DualNumber<N> operator*(DualNumber<N> x, DualNumber<N> const& y)
+{
+    return x *= y;
+}
+
+template <int N>
+DualNumber<N> operator/(DualNumber<N> x, DualNumber<N> const& y)
+{
+    return x /= y;
+}
+
+// Mixed operations with constants avoid the promotion to a dual number.
+
+template <int N>
+DualNumber<N> operator+(DualNumber<N> const& x, double const a)
+{
+    return {x.value() + a, x.derivatives()};
+}
+
+template <int N>
+DualNumber<N> operator+(double const a, DualNumber<N> const& x)
+{
+    return x + a;
+}
+
+template <int N>
+DualNumber<N> operator-(DualNumber<N> const& x, double const a)
+{
+    return {x.value() - a, x.derivatives()};
+}
+
+template <int N>
+DualNumber<N> operator-(double const a, DualNumber<N> const& x)
+{
+    return {a - x.value(), -x.derivatives()};
+}
+
+template <int N>
+DualNumber<N> operator*(DualNumber<N> const& x, double const a)
+{
+    return {x.value() * a, x.derivatives() * a};
+}
+
+template <int N>
+DualNumber<N> operator*(double const a, DualNumber<N> const& x)
+{
+    return x * a;
+}
+
+template <int N>
+DualNumber<N> operator/(DualNumber<N> const& x, double const a)
+{
+    return {x.value() / a, x.derivatives() / a};
+}
+
+template <int N>
+DualNumber<N> operator/(double const a, DualNumber<N> const& x)
+{
+    double const inv = 1.0 / x.value();
+    return {a * inv, (-a * inv * inv) * x.derivatives()};
+}
+
+// Comparisons only consider the values.
+
+#define OGS_DUAL_NUMBER_COMPARISON(OP)                                  \
+    template <int N>                                                    \
+    bool operator OP(DualNumber<N> const& x, DualNumber<N> const& y)    \
+    {                                                                   \
+        return x.value() OP y.value();                                  \
+    }                                                                   \
+    template <int N>                                                    \
+    bool operator OP(DualNumber<N> const& x, double const a)            \
+    {                                                                   \
+        return x.value() OP a;                                          \
+    }                                                                   \
+    template <int N>                                                    \
+    bool operator OP(double const a, DualNumber<N> const& x)            \
+    {                                                                   \
+        return a OP x.value();                                          \
+    }
+
+OGS_DUAL_NUMBER_COMPARISON(<)
+OGS_DUAL_NUMBER_COMPARISON(<=)
+OGS_DUAL_NUMBER_COMPARISON(>)
+OGS_DUAL_NUMBER_COMPARISON(>=)
+OGS_DUAL_NUMBER_COMPARISON(==)
+OGS_DUAL_NUMBER_COMPARISON(!=)
+
+#undef OGS_DUAL_NUMBER_COMPARISON
+
+// Elementary functions; the chain rule is applied to all derivatives at once.
+
+template <int N>
+DualNumber<N> exp(DualNumber<N> const& x)
+{
+    double const e = std::exp(x.value());
+    return {e, e * x.derivatives()};
+}
+
+template <int N>
+DualNumber<N> log(DualNumber<N> const& x)
+{
+    return {std::log(x.value()), x.derivatives() / x.value()};
+}
+
+template <int N>
+DualNumber<N> sqrt(DualNumber<N> const& x)
+{
+    double const s = std::sqrt(x.value());
+    return {s, x.derivatives() / (2.0 * s)};
+}
+
+template <int N>
+DualNumber<N> pow(DualNumber<N> const& x, double const a)
+{
+    double const p = std::pow(x.value(), a - 1.0);
+    return {p * x.value(), (a * p) * x.derivatives()};
+}
+
+template <int N>
+DualNumber<N> pow(DualNumber<N> const& x, DualNumber<N> const& y)
+{
+    double const p = std::pow(x.value(), y.value());
+    return {p, p * (y.derivatives() * std::log(x.value()) +
+                    (y.value() / x.value()) * x.derivatives())};
+}
+
+template <int N>
+DualNumber<N> abs(DualNumber<N> const& x)
+{
+    return x.value() < 0.0 ? -x : x;
+}
+
+template <int N>
+DualNumber<N> sin(DualNumber<N> const& x)
+{
+    return {std::sin(x.value()), std::cos(x.value()) * x.derivatives()};
+}
+
+template <int N>
+DualNumber<N> cos(DualNumber<N> const& x)
+{
+    return {std::cos(x.value()), -std::sin(x.value()) * x.derivatives()};
+}
+
+template <int N>
+DualNumber<N> tanh(DualNumber<N> const& x)
+{
+    double const t = std::tanh(x.value());
+    return {t, (1.0 - t * t) * x.derivatives()};
+}
+
+/// Returns the value of a dual number, or the argument itself for doubles.
+/// Useful in code templated on the scalar type.
+inline double getValue(double const x)
+{
+    return x;
+}
+
+template <int N>
+double getValue(DualNumber<N> const& x)
+{
+    return x.value();
+}
+
+}  // namespace MathLib
+
+namespace Eigen
+{
+template <int N>
+struct NumTraits<MathLib::DualNumber<N>> : NumTraits<double>
+{
+    using Real = MathLib::DualNumber<N>;
+    using NonInteger = MathLib::DualNumber<N>;
+    using Nested = MathLib::DualNumber<N>;
+    using Literal = MathLib::DualNumber<N>;
+
+    enum
+    {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = 1 + N,
+        AddCost = 1 + N,
+        MulCost = 1 + 2 * N
+    };
+};
+
+template <int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<MathLib::DualNumber<N>, double, BinaryOp>
+{
+    using ReturnType = MathLib::DualNumber<N>;
+};
+
+template <int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<double, MathLib::DualNumber<N>, BinaryOp>
+{
+    using ReturnType = MathLib::DualNumber<N>;
+};
+}  // namespace Eigen
@@ -0,0 +1,377 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+#include <Eigen/Eigenvalues>
+#include <Eigen/Jacobi>
+#include <Eigen/QR>
+#include <Eigen/SparseCore>
+
+namespace MathLib
+{
+/**
+ * GMRES with deflated restarting and subspace recycling (GCRO-DR).
+ *
+ * The solver keeps a subspace \f$ U \f$ spanned by approximate eigenvectors
+ * of the system matrix belonging to the eigenvalues of smallest magnitude
+ * (harmonic Ritz vectors). The subspace is deflated from the Krylov space of
+ * each restart cycle and it is kept between consecutive solves, i.e., across
+ * Newton iterations and time steps, which removes the slowly converging
+ * modes of slowly changing system matrices.
+ *
+ * The preconditioner is applied from the right. The preconditioned search
+ * directions are stored explicitly (flexible variant), such that the
+ * recycled subspace lives in the solution space.
+ *
+ * The interface follows the one of the Eigen iterative solvers.
+ *
+ * See M. L. Parks, E. de Sturler, G. Mackey, D. D. Johnson and S. Maiti,
+ * Recycling Krylov subspaces for sequences of linear systems, SIAM J. Sci.
+ * Comput. 28(5), 2006.
+ */
+template <typename Mat, typename Precon>
+class EigenGCRODR final
+{
+public:
+    using Vector = Eigen::VectorXd;
+    using DenseMatrix = Eigen::MatrixXd;
+
+    void setTolerance(double const tolerance) { _tolerance = tolerance; }
+    void setMaxIterations(Eigen::Index const max_iterations)
+    {
+        _max_iterations = max_iterations;
+    }
+    /// Sets the maximum dimension of the search space of one restart cycle
+    /// including the recycled subspace.
+    void setRestart(Eigen::Index const restart) { _restart = restart; }
+    /// Sets the number of vectors kept in the recycled subspace. Zero
+    /// disables the recycling, i.e., the solver is a restarted GMRES.
+    void setRecycledSubspaceSize(Eigen::Index const size)
+    {
+        _recycled_subspace_size = size;
+    }
+
+    /// Sets the system matrix and computes the preconditioner. The recycled
+    /// subspace of the previous matrix is adapted to the new one.
+    EigenGCRODR& compute(Mat const& A)
+    {
+        _A = &A;
+        _precon.compute(A);
+        _info = _precon.info();
+        updateRecycledSubspace();
+        return *this;
+    }
+
+    template <typename Rhs, typename Guess>
+    Vector solveWithGuess(Rhs const& b, Guess const& x0)
+    {
+        Vector x = x0;
+        _iterations = 0;
+
+        double const b_norm = b.norm();
+        if (b_norm == 0)
+        {
+            x.setZero();
+            _error = 0;
+            _info = Eigen::Success;
+            return x;
+        }
+
+        Vector r = b - *_A * x;
+        _error = r.norm() / b_norm;
+        while (_error > _tolerance && _iterations < _max_iterations)
+        {
+            if (!cycle(b, b_norm, x, r))
+            {
+                break;
+            }
+        }
+
+        _info = _error <= _tolerance ? Eigen::Success : Eigen::NoConvergence;
+        return x;
+    }
+
+    Eigen::Index iterations() const { return _iterations; }
+    double error() const { return _error; }
+    Eigen::ComputationInfo info() const { return _info; }
+
+    /// Number of vectors currently held in the recycled subspace.
+    Eigen::Index recycledSubspaceSize() const { return _U.cols(); }
+
+private:
+    /// Recomputes \f$ C = A U \f$ with orthonormal columns for a new system
+    /// matrix. The subspace is dropped if its size does not fit the matrix or
+    /// if it became (numerically) rank deficient.
+    void updateRecycledSubspace()
+    {
+        if (_U.cols() == 0)
+        {
+            return;
+        }
+        if (_U.rows() != _A->rows())
+        {
+            dropRecycledSubspace();
+            return;
+        }
+
+        DenseMatrix const AU = *_A * _U;
+        DenseMatrix R;
+        if (!orthonormalize(AU, _C, R))
+        {
+            dropRecycledSubspace();
+            return;
+        }
+        R.triangularView<Eigen::Upper>().solveInPlace<Eigen::OnTheRight>(_U);
+    }
+
+    void dropRecycledSubspace()
+    {
+        _U.resize(0, 0);
+        _C.resize(0, 0);
+    }
+
+    /// Computes the thin QR decomposition \c M = \c Q * \c R. Returns false
+    /// if \c M is (numerically) rank deficient.
+    static bool orthonormalize(DenseMatrix const& M, DenseMatrix& Q,
+                               DenseMatrix& R)
+    {
+        Eigen::HouseholderQR<DenseMatrix> const qr(M);
+        auto const k = M.cols();
+        R = qr.matrixQR().topRows(k).template triangularView<Eigen::Upper>();
+        double const max_diagonal = R.diagonal().cwiseAbs().maxCoeff();
+        if (!(max_diagonal > 0) ||
+            R.diagonal().cwiseAbs().minCoeff() <
+                max_diagonal * 1e3 * std::numeric_limits<double>::epsilon())
+        {
+            return false;
+        }
+        Q = qr.householderQ() * DenseMatrix::Identity(M.rows(), k);
+        return true;
+    }
+
+    /// Runs one restart cycle. Returns false if the iteration cannot make
+    /// progress.
+    template <typename Rhs>
+    bool cycle(Rhs const& b, double const b_norm, Vector& x, Vector& r)
+    {
+        auto const& A = *_A;
+        auto const n = A.rows();
+        auto const k = _U.cols();
+
+        // The residual is minimized over the recycled subspace first.
+        if (k > 0)
+        {
+            Vector const c = _C.transpose() * r;
+            x += _U * c;
+            r -= _C * c;
+        }
+
+        auto const m = std::max<Eigen::Index>(1, _restart - k);
+        DenseMatrix V = DenseMatrix::Zero(n, m + 1);
+        DenseMatrix Z(n, m);
+        DenseMatrix H = DenseMatrix::Zero(m + 1, m);
+        DenseMatrix B = DenseMatrix::Zero(k, m);
+
+        double const beta = r.norm();
+        if (beta == 0)
+        {
+            _error = 0;
+            return false;
+        }
+        V.col(0) = r / beta;
+
+        // Givens rotated copy of H and right-hand side of the least squares
+        // problem min ||beta e_1 - H y||.
+        DenseMatrix R = DenseMatrix::Zero(m + 1, m);
+        Vector g = Vector::Zero(m + 1);
+        g(0) = beta;
+        std::vector<Eigen::JacobiRotation<double>> rotations(m);
+
+        Eigen::Index j = 0;
+        while (j < m && _iterations < _max_iterations)
+        {
+            Vector const z = _precon.solve(V.col(j));
+            Z.col(j) = z;
+            Vector w = A * z;
+            if (k > 0)
+            {
+                B.col(j) = _C.transpose() * w;
+                w -= _C * B.col(j);
+            }
+            for (Eigen::Index i = 0; i <= j; ++i)
+            {
+                H(i, j) = V.col(i).dot(w);
+                w -= H(i, j) * V.col(i);
+            }
+            H(j + 1, j) = w.norm();
+            if (H(j + 1, j) > 0)
+            {
+                V.col(j + 1) = w / H(j + 1, j);
+            }
+
+            Vector h = H.col(j);
+            for (Eigen::Index i = 0; i < j; ++i)
+            {
+                h.applyOnTheLeft(i, i + 1, rotations[i].adjoint());
+            }
+            rotations[j].makeGivens(h(j), h(j + 1));
+            h.applyOnTheLeft(j, j + 1, rotations[j].adjoint());
+            g.applyOnTheLeft(j, j + 1, rotations[j].adjoint());
+            R.col(j) = h;
+
+            ++j;
+            ++_iterations;
+            if (std::abs(g(j)) <= _tolerance * b_norm || H(j, j - 1) == 0)
+            {
+                break;
+            }
+        }
+
+        if (R(j - 1, j - 1) == 0)
+        {
+            return false;
+        }
+        Vector const y = R.topLeftCorner(j, j)
+                             .triangularView<Eigen::Upper>()
+                             .solve(g.head(j));
+        x += Z.leftCols(j) * y;
+        if (k > 0)
+        {
+            x -= _U * (B.leftCols(j) * y);
+        }
+
+        r = b - A * x;
+        _error = r.norm() / b_norm;
+
+        if (_recycled_subspace_size > 0)
+        {
+            computeRecycledSubspace(V.leftCols(j + 1), Z.leftCols(j),
+                                    H.topLeftCorner(j + 1, j),
+                                    B.leftCols(j));
+        }
+        return true;
+    }
+
+    /// Replaces the recycled subspace by the harmonic Ritz vectors of the
+    /// search space \f$ S = [U, Z] \f$ of the last cycle. With
+    /// \f$ A S = W G \f$, \f$ W = [C, V] \f$, they solve
+    /// \f$ G^T G p = \theta G^T W^T S p \f$.
+    void computeRecycledSubspace(DenseMatrix const& V, DenseMatrix const& Z,
+                                 DenseMatrix const& H, DenseMatrix const& B)
+    {
+        auto const n = V.rows();
+        auto const k = _U.cols();
+        auto const j = Z.cols();
+        auto const s = k + j;
+
+        DenseMatrix S(n, s);
+        DenseMatrix W(n, s + 1);
+        if (k > 0)
+        {
+            S.leftCols(k) = _U;
+            W.leftCols(k) = _C;
+        }
+        S.rightCols(j) = Z;
+        W.rightCols(j + 1) = V;
+        DenseMatrix G = DenseMatrix::Zero(s + 1, s);
+        G.topLeftCorner(k, k).setIdentity();
+        G.topRightCorner(k, j) = B;
+        G.bottomRightCorner(j + 1, j) = H;
+
+        // With mu = 1 / theta the problem is transformed into a standard
+        // eigenvalue problem using the Cholesky factorization of G^T G.
+        Eigen::LLT<DenseMatrix> const llt(G.transpose() * G);
+        if (llt.info() != Eigen::Success)
+        {
+            return;
+        }
+        DenseMatrix M = G.transpose() * (W.transpose() * S);
+        llt.matrixL().solveInPlace(M);
+        llt.matrixU().solveInPlace<Eigen::OnTheRight>(M);
+        Eigen::EigenSolver<DenseMatrix> const eigen_solver(M);
+        if (eigen_solver.info() != Eigen::Success)
+        {
+            return;
+        }
+        auto const& mu = eigen_solver.eigenvalues();
+        auto const& q = eigen_solver.eigenvectors();
+
+        // Largest |mu|, i.e., smallest |theta| first. The real and imaginary
+        // parts of complex eigenvectors span the same real subspace as the
+        // conjugate pair.
+        std::vector<Eigen::Index> order(s);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&](Eigen::Index const a, Eigen::Index const b) {
+                             return std::abs(mu(a)) > std::abs(mu(b));
+                         });
+        auto const size = std::min(_recycled_subspace_size, s);
+        DenseMatrix P(s, size);
+        Eigen::Index p = 0;
+        for (auto const i : order)
+        {
+            if (p == size)
+            {
+                break;
+            }
+            if (mu(i).imag() < 0)
+            {
+                continue;
+            }
+            P.col(p++) = q.col(i).real();
+            if (mu(i).imag() > 0 && p < size)
+            {
+                P.col(p++) = q.col(i).imag();
+            }
+        }
+        P.conservativeResize(s, p);
+        llt.matrixU().solveInPlace(P);
+
+        // A S P = W G P = (W Q) R gives the new orthonormal C = W Q and
+        // U = S P R^-1.
+        DenseMatrix Q;
+        DenseMatrix R;
+        if (p == 0 || !orthonormalize(G * P, Q, R))
+        {
+            return;
+        }
+        _C = W * Q;
+        _U = S * P;
+        R.triangularView<Eigen::Upper>().solveInPlace<Eigen::OnTheRight>(_U);
+    }
+
+    Mat const* _A = nullptr;
+    Precon _precon;
+
+    double _tolerance = Eigen::NumTraits<double>::epsilon();
+    Eigen::Index _max_iterations = 1000;
+    Eigen::Index _restart = 30;
+    Eigen::Index _recycled_subspace_size = 10;
+
+    /// Recycled subspace and its image \f$ C = A U \f$ with orthonormal
+    /// columns.
+    DenseMatrix _U;
+    DenseMatrix _C;
+
+    Eigen::Index _iterations = 0;
+    double _error = 0;
+    Eigen::ComputationInfo _info = Eigen::Success;
+};
+
+}  // namespace MathLib
@@ -10,6 +10,9 @@
 
 #include "EigenLinearSolver.h"
 
+#include <algorithm>
+
+#include <Eigen/SparseCholesky>
 #include <logog/include/logog.hpp>
 
 #ifdef USE_MKL
@@ -23,6 +26,8 @@
 #endif
 
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/MemoryAccounting.h"
+#include "EigenGCRODR.h"
 #include "EigenVector.h"
 #include "EigenMatrix.h"
 #include "EigenTools.h"
@@ -43,6 +48,10 @@ public:
 
     //! Solves the linear equation system \f$ A x = b \f$ for \f$ x \f$.
     virtual bool solve(Matrix &A, Vector const& b, Vector &x, EigenOption &opt) = 0;
+
+    //! Name of the factorization used in the last solve, empty for iterative
+    //! solvers.
+    virtual std::string getLastFactorization() const { return {}; }
 };
 
 namespace details
@@ -81,6 +90,209 @@ private:
     T_SOLVER _solver;
 };
 
+/// Direct linear solver, which factorizes symmetric positive definite
+/// matrices by a Cholesky (LDL^T) decomposition and all other matrices by
+/// SparseLU. The symbolic factorizations are reused as long as the sparsity
+/// pattern of the matrix does not change. Once the Cholesky decomposition
+/// failed, it is not tried again for the same sparsity pattern.
+class EigenSparseLUOrCholeskyLinearSolver final : public EigenLinearSolverBase
+{
+public:
+    bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt) override
+    {
+        if (!A.isCompressed())
+        {
+            A.makeCompressed();
+        }
+
+        if (hasPatternChanged(A))
+        {
+            _cholesky_pattern_analyzed = false;
+            _lu_pattern_analyzed = false;
+            _not_positive_definite = false;
+            findMirroredEntries(A);
+        }
+
+        if (opt.use_cholesky && !_not_positive_definite && isSymmetric(A) &&
+            solveByCholesky(A, b, x))
+        {
+            _last_factorization = "SimplicialLDLT";
+            return true;
+        }
+
+        INFO("-> solve with SparseLU");
+        _last_factorization = "SparseLU";
+        if (!_lu_pattern_analyzed)
+        {
+            _lu.analyzePattern(A);
+            _lu_pattern_analyzed = true;
+        }
+        _lu.factorize(A);
+        if (_lu.info() != Eigen::Success)
+        {
+            ERR("Failed during Eigen linear solver initialization");
+            return false;
+        }
+        _factorization_memory.set(
+            static_cast<std::size_t>(_lu.nnzL() + _lu.nnzU()) *
+                (sizeof(Matrix::Scalar) + sizeof(Matrix::StorageIndex)) +
+            static_cast<std::size_t>(A.cols()) * 2 *
+                sizeof(Matrix::StorageIndex));
+
+        x = _lu.solve(b);
+        if (_lu.info() != Eigen::Success)
+        {
+            ERR("Failed during Eigen linear solve");
+            return false;
+        }
+
+        return true;
+    }
+
+    std::string getLastFactorization() const override
+    {
+        return _last_factorization;
+    }
+
+private:
+    /// Returns false if the matrix is not positive definite.
+    bool solveByCholesky(Matrix const& A, Vector const& b, Vector& x)
+    {
+        INFO("-> solve with SimplicialLDLT (symmetric matrix)");
+        if (!_cholesky_pattern_analyzed)
+        {
+            _cholesky.analyzePattern(A);
+            _cholesky_pattern_analyzed = true;
+        }
+        _cholesky.factorize(A);
+        if (_cholesky.info() != Eigen::Success ||
+            !(_cholesky.vectorD().minCoeff() > 0))
+        {
+            INFO("The matrix is not positive definite.");
+            _not_positive_definite = true;
+            return false;
+        }
+        auto const& L = _cholesky.matrixL().nestedExpression();
+        _factorization_memory.set(
+            static_cast<std::size_t>(L.nonZeros()) *
+                (sizeof(Matrix::Scalar) + sizeof(Matrix::StorageIndex)) +
+            static_cast<std::size_t>(L.cols()) *
+                (sizeof(Matrix::Scalar) + 3 * sizeof(Matrix::StorageIndex)));
+
+        x = _cholesky.solve(b);
+        return _cholesky.info() == Eigen::Success;
+    }
+
+    /// Compares the sparsity pattern with the one of the previous call.
+    bool hasPatternChanged(Matrix const& A)
+    {
+        auto const* const outer = A.outerIndexPtr();
+        auto const* const inner = A.innerIndexPtr();
+        if (static_cast<Eigen::Index>(_outer_index.size()) ==
+                A.outerSize() + 1 &&
+            static_cast<Eigen::Index>(_inner_index.size()) == A.nonZeros() &&
+            std::equal(_outer_index.begin(), _outer_index.end(), outer) &&
+            std::equal(_inner_index.begin(), _inner_index.end(), inner))
+        {
+            return false;
+        }
+        _outer_index.assign(outer, outer + A.outerSize() + 1);
+        _inner_index.assign(inner, inner + A.nonZeros());
+        return true;
+    }
+
+    /// For each stored entry \f$A_{ij}\f$ finds the position of
+    /// \f$A_{ji}\f$ in the value array of the matrix, or -1 if \f$A_{ji}\f$
+    /// is not stored. Needed only once per sparsity pattern.
+    void findMirroredEntries(Matrix const& A)
+    {
+        auto const* const outer = A.outerIndexPtr();
+        auto const* const inner = A.innerIndexPtr();
+        _mirrored_entry.assign(A.nonZeros(), -1);
+        if (A.rows() != A.cols())
+        {
+            return;
+        }
+        for (Eigen::Index i = 0; i < A.outerSize(); ++i)
+        {
+            for (auto k = outer[i]; k < outer[i + 1]; ++k)
+            {
+                auto const j = inner[k];
+                // The inner indices of compressed matrices are sorted.
+                auto const* const first = inner + outer[j];
+                auto const* const last = inner + outer[j + 1];
+                auto const* const it = std::lower_bound(first, last, i);
+                if (it != last && *it == i)
+                {
+                    _mirrored_entry[k] = it - inner;
+                }
+            }
+        }
+    }
+
+    /// Checks the symmetry of the matrix exactly, i.e., entry by entry. Even
+    /// small deviations are not neglected, because SimplicialLDLT uses only
+    /// the lower triangle of the matrix.
+    bool isSymmetric(Matrix const& A) const
+    {
+        if (A.rows() != A.cols())
+        {
+            return false;
+        }
+        auto const* const values = A.valuePtr();
+        for (Eigen::Index k = 0; k < A.nonZeros(); ++k)
+        {
+            auto const mirrored = _mirrored_entry[k];
+            if (values[k] != (mirrored < 0 ? 0.0 : values[mirrored]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Eigen::SparseLU<Matrix, Eigen::COLAMDOrdering<int>> _lu;
+    Eigen::SimplicialLDLT<Matrix> _cholesky;
+    bool _lu_pattern_analyzed = false;
+    bool _cholesky_pattern_analyzed = false;
+    /// Set if the Cholesky decomposition failed for the current sparsity
+    /// pattern.
+    bool _not_positive_definite = false;
+    std::string _last_factorization;
+
+    /// Estimated size of the factors of the last factorization.
+    BaseLib::TrackedMemory _factorization_memory{
+        BaseLib::MemoryTag::Factorizations};
+
+    std::vector<Matrix::StorageIndex> _outer_index;
+    std::vector<Matrix::StorageIndex> _inner_index;
+    /// Positions of the mirrored entries, see findMirroredEntries().
+    std::vector<Eigen::Index> _mirrored_entry;
+};
+
+/// Sets the options, which are specific to some of the iterative solvers.
+template <class T_SOLVER>
+void setSolverSpecificOptions(T_SOLVER& /*solver*/, EigenOption const& /*opt*/)
+{
+}
+
+#ifdef USE_EIGEN_UNSUPPORTED
+template <typename Mat, typename Precon>
+void setSolverSpecificOptions(Eigen::GMRES<Mat, Precon>& solver,
+                              EigenOption const& opt)
+{
+    solver.set_restart(opt.restart);
+}
+#endif
+
+template <typename Mat, typename Precon>
+void setSolverSpecificOptions(EigenGCRODR<Mat, Precon>& solver,
+                              EigenOption const& opt)
+{
+    solver.setRestart(opt.restart);
+    solver.setRecycledSubspaceSize(opt.recycled_subspace_size);
+}
+
 /// Template class for Eigen iterative linear solvers
 template <class T_SOLVER>
 class EigenIterativeLinearSolver final : public EigenLinearSolverBase
@@ -93,6 +305,7 @@ public:
              EigenOption::getPreconName(opt.precon_type).c_str());
         _solver.setTolerance(opt.error_tolerance);
         _solver.setMaxIterations(opt.max_iterations);
+        setSolverSpecificOptions(_solver, opt);
 
         if (!A.isCompressed())
         {
@@ -172,6 +385,9 @@ std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
                 "Linear solver type GMRES is not available.");
 #endif
         }
+        case EigenOption::SolverType::GCRODR: {
+            return createIterativeSolver<EigenGCRODR>(precon_type);
+        }
         default:
             OGS_FATAL("Invalid Eigen iterative linear solver type. Aborting.");
     }
@@ -183,8 +399,6 @@ EigenLinearSolver::EigenLinearSolver(
                             const std::string& /*solver_name*/,
                             const BaseLib::ConfigTree* const option)
 {
-    using Matrix = EigenMatrix::RawMatrixType;
-
     if (option)
     {
         setOption(*option);
@@ -194,15 +408,14 @@ EigenLinearSolver::EigenLinearSolver(
     //      currently is SparseLU.
     switch (_option.solver_type) {
         case EigenOption::SolverType::SparseLU: {
-            using SolverType =
-                Eigen::SparseLU<Matrix, Eigen::COLAMDOrdering<int>>;
             _solver = std::make_unique<
-                details::EigenDirectLinearSolver<SolverType>>();
+                details::EigenSparseLUOrCholeskyLinearSolver>();
             return;
         }
         case EigenOption::SolverType::BiCGSTAB:
         case EigenOption::SolverType::CG:
         case EigenOption::SolverType::GMRES:
+        case EigenOption::SolverType::GCRODR:
             _solver = details::createIterativeSolver(_option.solver_type,
                                                      _option.precon_type);
             return;
@@ -254,6 +467,21 @@ void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
             ptSolver->getConfigParameterOptional<int>("max_iteration_step")) {
         _option.max_iterations = *max_iteration_step;
     }
+    if (auto restart =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__restart}
+            ptSolver->getConfigParameterOptional<int>("restart")) {
+        _option.restart = *restart;
+    }
+    if (auto recycled_subspace_size =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__recycled_subspace_size}
+            ptSolver->getConfigParameterOptional<int>("recycled_subspace_size")) {
+        _option.recycled_subspace_size = *recycled_subspace_size;
+    }
+    if (auto use_cholesky =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__use_cholesky}
+            ptSolver->getConfigParameterOptional<bool>("use_cholesky")) {
+        _option.use_cholesky = *use_cholesky;
+    }
     if (auto scaling =
             //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__scaling}
             ptSolver->getConfigParameterOptional<bool>("scaling")) {
@@ -283,8 +511,10 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
         b.getRawVector() = scal->LeftScaling().cwiseProduct(b.getRawVector());
     }
 #endif
+    auto option = _option;
+    option.error_tolerance = std::max(_option.error_tolerance, _forcing_term);
     auto const success = _solver->solve(A.getRawMatrix(), b.getRawVector(),
-                                        x.getRawVector(), _option);
+                                        x.getRawVector(), option);
 #ifdef USE_EIGEN_UNSUPPORTED
     if (scal)
     {
@@ -297,4 +527,9 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
     return success;
 }
 
+std::string EigenLinearSolver::getLastFactorization() const
+{
+    return _solver->getLastFactorization();
+}
+
 }  // namespace MathLib
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "BaseLib/ConfigTree.h"
@@ -56,9 +57,20 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Name of the factorization used by the last solve() of a direct solver,
+    /// e.g., "SimplicialLDLT" or "SparseLU"; empty for iterative solvers.
+    std::string getLastFactorization() const;
+
+    /// For iterative solvers only, see NumLib::InexactNewtonForcingTerm.
+    void setForcingTerm(double const forcing_term)
+    {
+        _forcing_term = forcing_term;
+    }
+
 protected:
     EigenOption _option;
     std::unique_ptr<EigenLinearSolverBase> _solver;
+    double _forcing_term = 0;
 };
 
 }  // namespace MathLib
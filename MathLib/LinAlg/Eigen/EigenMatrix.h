@@ -15,6 +15,7 @@
 
 #include <Eigen/Sparse>
 
+#include "BaseLib/MemoryAccounting.h"
 #include "MathLib/LinAlg/RowColumnIndices.h"
 #include "MathLib/LinAlg/SetMatrixSparsity.h"
 #include "EigenVector.h"
@@ -48,6 +49,7 @@ public:
             _mat.reserve(Eigen::Matrix<IndexType, Eigen::Dynamic, 1>::Constant(
                 n, n_nonzero_columns));
         }
+        trackMemoryUsage();
     }
 
     /// return the number of rows
@@ -158,8 +160,25 @@ public:
     RawMatrixType& getRawMatrix() { return _mat; }
     const RawMatrixType& getRawMatrix() const { return _mat; }
 
+    /// Reports the memory allocated by the matrix to the memory accounting.
+    /// To be called after changes of the allocation, e.g., after the
+    /// assembly.
+    void trackMemoryUsage()
+    {
+        using StorageIndex = RawMatrixType::StorageIndex;
+        std::size_t const inner_non_zeros =
+            _mat.isCompressed() ? 0 : _mat.outerSize();
+        _memory.set(
+            _mat.data().allocatedSize() *
+                (sizeof(double) + sizeof(StorageIndex)) +
+            (_mat.outerSize() + 1 + inner_non_zeros) * sizeof(StorageIndex));
+    }
+
 protected:
     RawMatrixType _mat;
+
+private:
+    BaseLib::TrackedMemory _memory{BaseLib::MemoryTag::GlobalMatrices};
 };
 
 template <class T_DENSE_MATRIX>
@@ -195,6 +214,7 @@ void operator()(EigenMatrix &matrix, SPARSITY_PATTERN const& sparsity_pattern)
                == static_cast<EigenMatrix::IndexType>(sparsity_pattern.size()));
 
     matrix.getRawMatrix().reserve(sparsity_pattern);
+    matrix.trackMemoryUsage();
 }
 };
 
@@ -20,6 +20,9 @@ EigenOption::EigenOption()
     precon_type = PreconType::NONE;
     max_iterations = static_cast<int>(1e6);
     error_tolerance = 1.e-16;
+    restart = 30;
+    recycled_subspace_size = 10;
+    use_cholesky = false;
 #ifdef USE_EIGEN_UNSUPPORTED
     scaling = false;
 #endif
@@ -47,6 +50,10 @@ EigenOption::SolverType EigenOption::getSolverType(const std::string &solver_nam
     {
         return SolverType::GMRES;
     }
+    if (solver_name == "GCRODR")
+    {
+        return SolverType::GCRODR;
+    }
 
     OGS_FATAL("Unknown Eigen solver type `%s'", solver_name.c_str());
 }
@@ -82,6 +89,8 @@ std::string EigenOption::getSolverName(SolverType const solver_type)
             return "PardisoLU";
         case SolverType::GMRES:
             return "GMRES";
+        case SolverType::GCRODR:
+            return "GCRODR";
     }
     return "Invalid";
 }
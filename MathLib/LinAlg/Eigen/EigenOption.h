@@ -25,7 +25,8 @@ struct EigenOption final
         BiCGSTAB,
         SparseLU,
         PardisoLU,
-        GMRES
+        GMRES,
+        GCRODR
     };
 
     /// Preconditioner type
@@ -44,6 +45,14 @@ struct EigenOption final
     int max_iterations;
     /// Error tolerance
     double error_tolerance;
+    /// Maximum dimension of the search space of one restart cycle (GMRES,
+    /// GCRODR)
+    int restart;
+    /// Number of vectors kept in the recycled subspace between solves (GCRODR)
+    int recycled_subspace_size;
+    /// Factorize symmetric positive definite matrices by Cholesky instead of
+    /// LU (SparseLU)
+    bool use_cholesky;
 #ifdef USE_EIGEN_UNSUPPORTED
     /// Scaling the coefficient matrix and the RHS bector
     bool scaling;
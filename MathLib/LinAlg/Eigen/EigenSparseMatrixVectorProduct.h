@@ -0,0 +1,115 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+namespace MathLib
+{
+namespace details
+{
+//! Below this number of non-zero entries the sparse matrix vector product is
+//! computed by a single thread.
+constexpr long min_nonzeros_for_parallel_spmv = 50000;
+}  // namespace details
+
+//! Splits the rows of a compressed row major sparse matrix into
+//! \c number_of_parts contiguous ranges holding approximately the same number
+//! of non-zero entries. This balances the work of the threads for matrices
+//! with irregular row lengths.
+//!
+//! \param outer_index the CSR row offsets of length <tt>number_of_rows+1</tt>.
+//! \return the <tt>number_of_parts+1</tt> row boundaries of the ranges.
+template <typename Index>
+std::vector<Index> partitionRowsByNonZeros(Index const* const outer_index,
+                                           Index const number_of_rows,
+                                           int const number_of_parts)
+{
+    assert(number_of_parts > 0);
+    std::vector<Index> boundaries(number_of_parts + 1, number_of_rows);
+    boundaries[0] = 0;
+
+    auto const number_of_nonzeros =
+        static_cast<long>(outer_index[number_of_rows]);
+    for (int k = 1; k < number_of_parts; ++k)
+    {
+        auto const target = static_cast<Index>(number_of_nonzeros * k /
+                                               number_of_parts);
+        boundaries[k] = static_cast<Index>(
+            std::lower_bound(outer_index + boundaries[k - 1],
+                             outer_index + number_of_rows, target) -
+            outer_index);
+    }
+    return boundaries;
+}
+
+//! Computes \f$ y = A x + z \f$, or \f$ y = A x \f$ if \c z is \c nullptr, for
+//! a compressed row major sparse matrix.
+//!
+//! The rows are distributed over the OpenMP threads in ranges of balanced
+//! numbers of non-zero entries, cf. partitionRowsByNonZeros(). Every row is
+//! computed by exactly one thread, hence the result does not depend on the
+//! number of threads. \c z may be the same vector as \c y, \c x must not.
+inline void sparseMatrixVectorProduct(
+    Eigen::SparseMatrix<double, Eigen::RowMajor> const& A,
+    Eigen::VectorXd const& x, Eigen::VectorXd const* const z,
+    Eigen::VectorXd& y)
+{
+    assert(A.isCompressed());
+    assert(&x != &y);
+    assert(x.size() == A.cols());
+    assert(z == nullptr || z->size() == A.rows());
+
+    using StorageIndex =
+        Eigen::SparseMatrix<double, Eigen::RowMajor>::StorageIndex;
+    auto const number_of_rows = static_cast<StorageIndex>(A.rows());
+    StorageIndex const* const outer = A.outerIndexPtr();
+    StorageIndex const* const inner = A.innerIndexPtr();
+    double const* const values = A.valuePtr();
+
+    int number_of_parts = 1;
+#ifdef _OPENMP
+    if (A.nonZeros() >= details::min_nonzeros_for_parallel_spmv)
+    {
+        number_of_parts = omp_get_max_threads();
+    }
+#endif
+    auto const boundaries =
+        partitionRowsByNonZeros(outer, number_of_rows, number_of_parts);
+
+    y.resize(number_of_rows);
+
+#pragma omp parallel for schedule(static, 1) if (number_of_parts > 1)
+    for (int part = 0; part < number_of_parts; ++part)
+    {
+        for (StorageIndex row = boundaries[part]; row < boundaries[part + 1];
+             ++row)
+        {
+            double sum = 0;
+            for (StorageIndex k = outer[row]; k < outer[row + 1]; ++k)
+            {
+                sum += values[k] * x[inner[k]];
+            }
+            y[row] = z ? (*z)[row] + sum : sum;
+        }
+    }
+}
+
+}  // namespace MathLib
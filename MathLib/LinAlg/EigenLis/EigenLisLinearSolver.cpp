@@ -52,6 +52,7 @@ bool EigenLisLinearSolver::solve(EigenMatrix &A_, EigenVector& b_,
 
     LisLinearSolver lissol; // TODO not always creat Lis solver here
     lissol.setOption(_lis_option);
+    lissol.setForcingTerm(_forcing_term);
     bool const status = lissol.solve(lisA, lisb, lisx);
 
     for (std::size_t i=0; i<lisx.size(); i++)
@@ -47,8 +47,15 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Passed on to LisLinearSolver, see NumLib::InexactNewtonForcingTerm.
+    void setForcingTerm(double const forcing_term)
+    {
+        _forcing_term = forcing_term;
+    }
+
 private:
     LisOption _lis_option;
+    double _forcing_term = 0;
 };
 
 } // MathLib
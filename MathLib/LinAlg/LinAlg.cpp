@@ -65,6 +65,13 @@ void axpby(PETScVector& y, double const a, double const b, PETScVector const& x)
     VecAXPBY(y.getRawVector(), a, b, x.getRawVector());
 }
 
+double dot(PETScVector const& x, PETScVector const& y)
+{
+    PetscScalar result = 0.;
+    VecDot(x.getRawVector(), y.getRawVector(), &result);
+    return result;
+}
+
 // Explicit specialization
 // Computes w = x/y componentwise.
 template<>
@@ -136,6 +143,13 @@ void axpy(PETScMatrix& Y, double const a, PETScMatrix const& X)
             DIFFERENT_NONZERO_PATTERN);
 }
 
+// B = A^T
+void transpose(PETScMatrix const& A, PETScMatrix& B)
+{
+    B = A;
+    MatTranspose(B.getRawMatrix(), MAT_INPLACE_MATRIX, &B.getRawMatrix());
+}
+
 
 // Matrix and Vector
 
@@ -177,6 +191,7 @@ void finalizeAssembly(PETScVector& x)
 
 #include "MathLib/LinAlg/Eigen/EigenVector.h"
 #include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenSparseMatrixVectorProduct.h"
 
 namespace MathLib { namespace LinAlg
 {
@@ -223,6 +238,11 @@ void axpby(EigenVector& y, double const a, double const b, EigenVector const& x)
     y.getRawVector() = a * x.getRawVector() + b * y.getRawVector();
 }
 
+double dot(EigenVector const& x, EigenVector const& y)
+{
+    return x.getRawVector().dot(y.getRawVector());
+}
+
 // Explicit specialization
 // Computes w = x/y componentwise.
 template<>
@@ -286,6 +306,12 @@ void axpy(EigenMatrix& Y, double const a, EigenMatrix const& X)
     Y.getRawMatrix() = a*X.getRawMatrix() + Y.getRawMatrix();
 }
 
+// B = A^T
+void transpose(EigenMatrix const& A, EigenMatrix& B)
+{
+    B.getRawMatrix() = A.getRawMatrix().transpose();
+}
+
 
 // Matrix and Vector
 
@@ -293,6 +319,12 @@ void axpy(EigenMatrix& Y, double const a, EigenMatrix const& X)
 void matMult(EigenMatrix const& A, EigenVector const& x, EigenVector& y)
 {
     assert(&x != &y);
+    if (A.getRawMatrix().isCompressed())
+    {
+        sparseMatrixVectorProduct(A.getRawMatrix(), x.getRawVector(), nullptr,
+                                  y.getRawVector());
+        return;
+    }
     y.getRawVector() = A.getRawMatrix() * x.getRawVector();
 }
 
@@ -300,6 +332,12 @@ void matMult(EigenMatrix const& A, EigenVector const& x, EigenVector& y)
 void matMultAdd(EigenMatrix const& A, EigenVector const& v1, EigenVector const& v2, EigenVector& v3)
 {
     assert(&v1 != &v3);
+    if (A.getRawMatrix().isCompressed())
+    {
+        sparseMatrixVectorProduct(A.getRawMatrix(), v1.getRawVector(),
+                                  &v2.getRawVector(), v3.getRawVector());
+        return;
+    }
     // TODO: does that break anything?
     v3.getRawVector() = v2.getRawVector() + A.getRawMatrix()*v1.getRawVector();
 }
@@ -307,6 +345,7 @@ void matMultAdd(EigenMatrix const& A, EigenVector const& v1, EigenVector const&
 void finalizeAssembly(EigenMatrix& x)
 {
     x.getRawMatrix().makeCompressed();
+    x.trackMemoryUsage();
 }
 
 void finalizeAssembly(EigenVector& /*x*/) {}
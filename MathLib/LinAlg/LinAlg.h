@@ -165,6 +165,9 @@ void axpy(PETScVector& y, double const a, PETScVector const& x);
 // y = a*x + y
 void axpby(PETScVector& y, double const a, double const b, PETScVector const& x);
 
+// x^T y
+double dot(PETScVector const& x, PETScVector const& y);
+
 
 // Matrix
 
@@ -179,6 +182,9 @@ void aypx(PETScMatrix& Y, double const a, PETScMatrix const& X);
 // Y = a*X + Y
 void axpy(PETScMatrix& Y, double const a, PETScMatrix const& X);
 
+// B = A^T, A has to be square.
+void transpose(PETScMatrix const& A, PETScMatrix& B);
+
 
 // Matrix and Vector
 
@@ -233,6 +239,9 @@ void axpy(EigenVector& y, double const a, EigenVector const& x);
 // y = a*x + y
 void axpby(EigenVector& y, double const a, double const b, EigenVector const& x);
 
+// x^T y
+double dot(EigenVector const& x, EigenVector const& y);
+
 
 // Matrix
 
@@ -247,6 +256,9 @@ void aypx(EigenMatrix& Y, double const a, EigenMatrix const& X);
 // Y = a*X + Y
 void axpy(EigenMatrix& Y, double const a, EigenMatrix const& X);
 
+// B = A^T
+void transpose(EigenMatrix const& A, EigenMatrix& B);
+
 
 // Matrix and Vector
 
@@ -18,12 +18,36 @@
 
 #include "LisLinearSolver.h"
 
+#include <algorithm>
+#include <sstream>
+
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/StringTools.h"
+
 #include "LisCheck.h"
 #include "LisMatrix.h"
 #include "LisVector.h"
 
+namespace
+{
+/// Returns the value of the last -tol option or the default of Lis.
+double getRelativeTolerance(std::string const& option_string)
+{
+    double tolerance = 1e-12;
+    std::istringstream options(option_string);
+    std::string option;
+    while (options >> option)
+    {
+        if (option == "-tol")
+        {
+            options >> tolerance;
+        }
+    }
+    return tolerance;
+}
+}  // namespace
+
 namespace MathLib
 {
 
@@ -49,6 +73,15 @@ bool LisLinearSolver::solve(LisMatrix &A, LisVector &b, LisVector &x)
 
     lis_solver_set_option(
         const_cast<char*>(_lis_option._option_string.c_str()), solver);
+    if (_forcing_term > 0)
+    {
+        // Later options override the earlier ones.
+        double const tolerance = std::max(
+            getRelativeTolerance(_lis_option._option_string), _forcing_term);
+        auto const tolerance_option = BaseLib::format("-tol %g", tolerance);
+        lis_solver_set_option(const_cast<char*>(tolerance_option.c_str()),
+                              solver);
+    }
 #ifdef _OPENMP
     INFO("-> number of threads: %i", (int) omp_get_max_threads());
 #endif
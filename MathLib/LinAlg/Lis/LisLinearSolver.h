@@ -55,8 +55,15 @@ public:
 
     bool solve(LisMatrix& A, LisVector &b, LisVector &x);
 
+    /// Given to Lis as -tol option, see NumLib::InexactNewtonForcingTerm.
+    void setForcingTerm(double const forcing_term)
+    {
+        _forcing_term = forcing_term;
+    }
+
 private:
     LisOption _lis_option;
+    double _forcing_term = 0;
 };
 
 } // MathLib
@@ -15,6 +15,9 @@
 */
 
 #include "PETScLinearSolver.h"
+
+#include <algorithm>
+
 #include "BaseLib/RunTime.h"
 #include "MathLib/LinAlg/LinearSolverOptions.h"
 
@@ -51,6 +54,24 @@ PETScLinearSolver::PETScLinearSolver(const std::string /*prefix*/,
                 if (!pre->empty())
                     prefix = *pre + "_";
             }
+
+            if (auto const reuse =
+                    //! \ogs_file_param{prj__linear_solvers__linear_solver__petsc__preconditioner_reuse}
+                subtree->getConfigSubtreeOptional("preconditioner_reuse"))
+            {
+                _reuse_preconditioner = true;
+                _max_solves_with_same_preconditioner =
+                    //! \ogs_file_param{prj__linear_solvers__linear_solver__petsc__preconditioner_reuse__max_solves}
+                    reuse->getConfigParameter<int>("max_solves", 0);
+                _max_iteration_growth_factor =
+                    //! \ogs_file_param{prj__linear_solvers__linear_solver__petsc__preconditioner_reuse__iteration_growth_factor}
+                    reuse->getConfigParameter<double>("iteration_growth_factor",
+                                                      0);
+                _update_preconditioner_on_dt_change =
+                    //! \ogs_file_param{prj__linear_solvers__linear_solver__petsc__preconditioner_reuse__update_on_dt_change}
+                    reuse->getConfigParameter<bool>("update_on_dt_change",
+                                                    true);
+            }
         }
     }
 #if PETSC_VERSION_LT(3, 7, 0)
@@ -70,6 +91,10 @@ PETScLinearSolver::PETScLinearSolver(const std::string /*prefix*/,
 
     KSPSetInitialGuessNonzero(_solver, PETSC_TRUE);
     KSPSetFromOptions(_solver);  // set run-time options
+
+    KSPGetTolerances(_solver, &_relative_tolerance, nullptr, nullptr,
+                     nullptr);
+    _applied_relative_tolerance = _relative_tolerance;
 }
 
 bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
@@ -83,6 +108,10 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
     PetscMemoryGetCurrentUsage(&mem1);
 #endif
 
+    bool preconditioner_updated = isPreconditionerUpdateRequired();
+    KSPSetReusePreconditioner(
+        _solver, preconditioner_updated ? PETSC_FALSE : PETSC_TRUE);
+
 #if (PETSC_VERSION_NUMBER > 3040)
     KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix());
 #else
@@ -90,11 +119,50 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
                     DIFFERENT_NONZERO_PATTERN);
 #endif
 
+    // The initial guess is kept for a second solve with an updated
+    // preconditioner, because x may contain NaN or Inf after a divergence.
+    Vec initial_guess = nullptr;
+    if (!preconditioner_updated)
+    {
+        VecDuplicate(x.getRawVector(), &initial_guess);
+        VecCopy(x.getRawVector(), initial_guess);
+    }
+
     KSPSolve(_solver, b.getRawVector(), x.getRawVector());
 
     KSPConvergedReason reason;
     KSPGetConvergedReason(_solver, &reason);
 
+    if (reason < 0 && !preconditioner_updated)
+    {
+        // The outdated preconditioner might be the cause of the divergence.
+        PetscPrintf(PETSC_COMM_WORLD,
+                    "\nLinear solver diverged with a reused preconditioner. "
+                    "Solving again with an updated preconditioner.\n");
+        preconditioner_updated = true;
+        KSPSetReusePreconditioner(_solver, PETSC_FALSE);
+#if (PETSC_VERSION_NUMBER > 3040)
+        KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix());
+#else
+        KSPSetOperators(_solver, A.getRawMatrix(), A.getRawMatrix(),
+                        DIFFERENT_NONZERO_PATTERN);
+#endif
+        VecCopy(initial_guess, x.getRawVector());
+        KSPSolve(_solver, b.getRawVector(), x.getRawVector());
+        KSPGetConvergedReason(_solver, &reason);
+    }
+    VecDestroy(&initial_guess);
+
+    KSPGetIterationNumber(_solver, &_iterations_of_last_solve);
+    if (preconditioner_updated)
+    {
+        _is_preconditioner_set_up = true;
+        _is_preconditioner_update_requested = false;
+        _solves_with_current_preconditioner = 0;
+        _iterations_with_new_preconditioner = _iterations_of_last_solve;
+    }
+    ++_solves_with_current_preconditioner;
+
     bool converged = true;
     if (reason > 0)
     {
@@ -187,4 +255,44 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
     return converged;
 }
 
+void PETScLinearSolver::setForcingTerm(double const forcing_term)
+{
+    PetscReal const relative_tolerance =
+        std::max(_relative_tolerance, static_cast<PetscReal>(forcing_term));
+    if (relative_tolerance != _applied_relative_tolerance)
+    {
+        KSPSetTolerances(_solver, relative_tolerance, PETSC_DEFAULT,
+                         PETSC_DEFAULT, PETSC_DEFAULT);
+        _applied_relative_tolerance = relative_tolerance;
+    }
+}
+
+void PETScLinearSolver::setTimeStepSize(double const dt)
+{
+    if (_update_preconditioner_on_dt_change && dt != _dt)
+    {
+        _is_preconditioner_update_requested = true;
+    }
+    _dt = dt;
+}
+
+bool PETScLinearSolver::isPreconditionerUpdateRequired() const
+{
+    if (!_reuse_preconditioner || !_is_preconditioner_set_up ||
+        _is_preconditioner_update_requested)
+    {
+        return true;
+    }
+    if (_max_solves_with_same_preconditioner > 0 &&
+        _solves_with_current_preconditioner >=
+            _max_solves_with_same_preconditioner)
+    {
+        return true;
+    }
+    return _max_iteration_growth_factor > 0 &&
+           _iterations_of_last_solve >
+               _max_iteration_growth_factor *
+                   std::max<PetscInt>(_iterations_with_new_preconditioner, 1);
+}
+
 }  // end of namespace
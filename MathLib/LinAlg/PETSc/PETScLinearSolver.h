@@ -64,11 +64,46 @@ public:
 
     /// Get elapsed wall clock time.
     double getElapsedTime() const { return _elapsed_ctime; }
+
+    /// Informs the solver about the time step size of the following solves.
+    /// If the preconditioner is reused, a change of the time step size
+    /// triggers its rebuild, because the weight of the mass matrix changes.
+    void setTimeStepSize(double const dt);
+
+    /// Set as KSP relative tolerance, see NumLib::InexactNewtonForcingTerm.
+    void setForcingTerm(double const forcing_term);
+
 private:
+    /// Checks the preconditioner reuse policy.
+    bool isPreconditionerUpdateRequired() const;
+
     KSP _solver;  ///< Solver type.
     PC _pc;       ///< Preconditioner type.
 
     double _elapsed_ctime = 0.0;  ///< Clock time
+
+    /// If set, the preconditioner is kept between solves until one of the
+    /// conditions below requires its rebuild.
+    bool _reuse_preconditioner = false;
+    /// Rebuild the preconditioner after this number of solves.
+    int _max_solves_with_same_preconditioner = 0;
+    /// Rebuild the preconditioner if the number of iterations exceeds the one
+    /// of the first solve with the current preconditioner by this factor.
+    double _max_iteration_growth_factor = 0;
+    /// Rebuild the preconditioner if the time step size changes.
+    bool _update_preconditioner_on_dt_change = true;
+
+    bool _is_preconditioner_set_up = false;
+    bool _is_preconditioner_update_requested = false;
+    int _solves_with_current_preconditioner = 0;
+    PetscInt _iterations_with_new_preconditioner = 0;
+    PetscInt _iterations_of_last_solve = 0;
+    double _dt = 0;
+
+    /// Relative tolerance given by the options.
+    PetscReal _relative_tolerance = 0;
+    /// Relative tolerance of the following solves.
+    PetscReal _applied_relative_tolerance = 0;
 };
 
 }  // end namespace
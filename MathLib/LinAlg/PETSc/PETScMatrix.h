@@ -20,6 +20,7 @@
 #include "PETScMatrixOption.h"
 #include "PETScVector.h"
 
+#include "BaseLib/MemoryAccounting.h"
 #include "MathLib/LinAlg/RowColumnIndices.h"
 
 typedef Mat PETSc_Mat;
@@ -69,6 +70,12 @@ public:
     {
         MatAssemblyBegin(_A, asm_type);
         MatAssemblyEnd(_A, asm_type);
+        if (asm_type == MAT_FINAL_ASSEMBLY)
+        {
+            MatInfo info;
+            MatGetInfo(_A, MAT_LOCAL, &info);
+            _memory.set(static_cast<std::size_t>(info.memory));
+        }
     }
 
     /// Get the number of rows.
@@ -238,6 +245,9 @@ private:
     /// Ending index in a rank
     PetscInt _end_rank;
 
+    /// Memory of the local part of the matrix as reported by PETSc.
+    BaseLib::TrackedMemory _memory{BaseLib::MemoryTag::GlobalMatrices};
+
     /*!
       \brief Create the matrix, configure memory allocation and set the
       related member data.
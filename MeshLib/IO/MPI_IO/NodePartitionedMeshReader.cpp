@@ -15,6 +15,9 @@
 
 #include "NodePartitionedMeshReader.h"
 
+#include <fstream>
+#include <sstream>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_PETSC
@@ -214,14 +217,43 @@ void NodePartitionedMeshReader::readPropertiesBinary(
     const std::string fname_cfg = file_name_base + "_partitioned_" + item_type +
                                   "_properties_cfg" +
                                   std::to_string(_mpi_comm_size) + ".bin";
-    std::ifstream is(fname_cfg.c_str(), std::ios::binary | std::ios::in);
-    if (!is)
+
+    // The meta data of all property vectors, the table of contents of the
+    // values file, is read by the first process only and broadcast.
+    std::vector<char> cfg_data;
+    if (_mpi_rank == 0)
+    {
+        std::ifstream is(fname_cfg.c_str(),
+                         std::ios::binary | std::ios::in | std::ios::ate);
+        if (is)
+        {
+            cfg_data.resize(static_cast<std::size_t>(is.tellg()));
+            is.seekg(0);
+            if (!is.read(cfg_data.data(), cfg_data.size()))
+            {
+                cfg_data.clear();
+            }
+        }
+    }
+    unsigned long cfg_size = cfg_data.size();
+    MPI_Bcast(&cfg_size, 1, MPI_UNSIGNED_LONG, 0, _mpi_comm);
+    if (cfg_size == 0)
     {
         WARN("Could not open file '%s'.\n"
              "\tYou can ignore this warning if the mesh does not contain %s-"
              "wise property data.", fname_cfg.c_str(), item_type.data());
         return;
     }
+    if (!is_safely_convertable<unsigned long, int>(cfg_size))
+    {
+        OGS_FATAL("The file '%s' is too large for MPI_Bcast().",
+                  fname_cfg.c_str());
+    }
+    cfg_data.resize(cfg_size);
+    MPI_Bcast(cfg_data.data(), static_cast<int>(cfg_size), MPI_CHAR, 0,
+              _mpi_comm);
+
+    std::istringstream is(std::string(cfg_data.begin(), cfg_data.end()));
     std::size_t number_of_properties = 0;
     is.read(reinterpret_cast<char*>(&number_of_properties), sizeof(std::size_t));
     std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>> vec_pvmd(
@@ -253,7 +285,7 @@ void NodePartitionedMeshReader::readPropertiesBinary(
         MeshLib::IO::readPropertyVectorPartitionMetaData(is));
     bool pvpmd_read_ok = static_cast<bool>(pvpmd);
     bool all_pvpmd_read_ok;
-    MPI_Allreduce(&pvpmd_read_ok, &all_pvpmd_read_ok, 1, MPI_C_BOOL, MPI_LOR,
+    MPI_Allreduce(&pvpmd_read_ok, &all_pvpmd_read_ok, 1, MPI_C_BOOL, MPI_LAND,
                   _mpi_comm);
     if (!all_pvpmd_read_ok)
     {
@@ -264,20 +296,12 @@ void NodePartitionedMeshReader::readPropertiesBinary(
     }
     DBUG("[%d] offset in the PropertyVector: %d", _mpi_rank, pvpmd->offset);
     DBUG("[%d] %d tuples in partition.", _mpi_rank, pvpmd->number_of_tuples);
-    is.close();
 
     const std::string fname_val = file_name_base + "_partitioned_" + item_type +
                                   "_properties_val" +
                                   std::to_string(_mpi_comm_size) + ".bin";
-    is.open(fname_val.c_str(), std::ios::binary | std::ios::in);
-    if (!is)
-    {
-        ERR("Could not open file '%s'\n."
-            "\tYou can ignore this warning if the mesh does not contain %s-"
-             "wise property data.", fname_val.c_str(), item_type.data());
-    }
 
-    readDomainSpecificPartOfPropertyVectors(vec_pvmd, *pvpmd, t, is, p);
+    readDomainSpecificPartOfPropertyVectors(vec_pvmd, *pvpmd, t, fname_val, p);
 }
 
 void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
@@ -285,52 +309,121 @@ void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
         vec_pvmd,
     MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
     MeshLib::MeshItemType t,
-    std::istream& is,
+    std::string const& file_name,
     MeshLib::Properties& p) const
 {
-    unsigned long global_offset = 0;
     std::size_t const number_of_properties = vec_pvmd.size();
+    if (!is_safely_convertable<std::size_t, int>(number_of_properties))
+    {
+        OGS_FATAL("Too many property vectors in file '%s'.",
+                  file_name.c_str());
+    }
+
+    // The values file stores the property vectors one after the other, each
+    // of them with the parts of all partitions in sequence. Collect the byte
+    // ranges of this partition's parts and their positions in the read
+    // buffer.
+    std::vector<int> block_lengths(number_of_properties);
+    std::vector<MPI_Aint> displacements(number_of_properties);
+    std::vector<std::size_t> buffer_offsets(number_of_properties + 1, 0);
+    unsigned long global_offset = 0;
     for (std::size_t i(0); i < number_of_properties; ++i)
     {
+        auto const& pvmd = *vec_pvmd[i];
+        unsigned long const tuple_size_in_bytes =
+            pvmd.data_type_size_in_bytes * pvmd.number_of_components;
+        unsigned long const number_of_bytes =
+            tuple_size_in_bytes * pvpmd.number_of_tuples;
+        if (!is_safely_convertable<unsigned long, int>(number_of_bytes))
+        {
+            OGS_FATAL(
+                "Error in NodePartitionedMeshReader::readPropertiesBinary: "
+                "The part %d of the PropertyVector '%s' is too large for "
+                "MPI-IO.",
+                _mpi_rank, pvmd.property_name.c_str());
+        }
+        block_lengths[i] = static_cast<int>(number_of_bytes);
+        displacements[i] = static_cast<MPI_Aint>(
+            global_offset + pvpmd.offset * tuple_size_in_bytes);
+        buffer_offsets[i + 1] = buffer_offsets[i] + number_of_bytes;
         DBUG("[%d] global offset: %d, offset within the PropertyVector: %d.",
-             _mpi_rank, global_offset,
-             global_offset +
-                 pvpmd.offset * vec_pvmd[i]->data_type_size_in_bytes);
-        if (vec_pvmd[i]->is_int_type)
+             _mpi_rank, global_offset, displacements[i]);
+
+        global_offset += tuple_size_in_bytes * pvmd.number_of_tuples;
+    }
+
+    std::vector<char> buffer(buffer_offsets.back());
+    if (!is_safely_convertable<std::size_t, int>(buffer.size()))
+    {
+        OGS_FATAL(
+            "Error in NodePartitionedMeshReader::readPropertiesBinary: "
+            "The properties of part %d are too large for MPI-IO.",
+            _mpi_rank);
+    }
+
+    MPI_Datatype file_type;
+    MPI_Type_create_hindexed(static_cast<int>(number_of_properties),
+                             block_lengths.data(), displacements.data(),
+                             MPI_BYTE, &file_type);
+    MPI_Type_commit(&file_type);
+
+    MPI_File file;
+    char* file_name_char = const_cast<char*>(file_name.data());
+    int const file_status = MPI_File_open(
+        _mpi_comm, file_name_char, MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+    if (file_status != MPI_SUCCESS)
+    {
+        MPI_Type_free(&file_type);
+        OGS_FATAL("Could not open file '%s'. MPI error code %d.",
+                  file_name.c_str(), file_status);
+    }
+
+    char file_mode[] = "native";
+    MPI_File_set_view(file, 0, MPI_BYTE, file_type, file_mode, MPI_INFO_NULL);
+    // The static cast is checked above.
+    int const read_status =
+        MPI_File_read_all(file, buffer.data(), static_cast<int>(buffer.size()),
+                          MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_File_close(&file);
+    MPI_Type_free(&file_type);
+    if (read_status != MPI_SUCCESS)
+    {
+        OGS_FATAL(
+            "Error in NodePartitionedMeshReader::readPropertiesBinary: "
+            "Could not read part %d of the PropertyVectors from file '%s'.",
+            _mpi_rank, file_name.c_str());
+    }
+
+    for (std::size_t i(0); i < number_of_properties; ++i)
+    {
+        auto const& pvmd = *vec_pvmd[i];
+        char const* const data = buffer.data() + buffer_offsets[i];
+        if (pvmd.is_int_type)
         {
-            if (vec_pvmd[i]->is_data_type_signed)
+            if (pvmd.is_data_type_signed)
             {
-                if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(int))
-                    createPropertyVectorPart<int>(is, *vec_pvmd[i], pvpmd, t,
-                                                  global_offset, p);
-                if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(long))
-                    createPropertyVectorPart<long>(is, *vec_pvmd[i], pvpmd, t,
-                                                   global_offset, p);
+                if (pvmd.data_type_size_in_bytes == sizeof(int))
+                    createPropertyVectorPart<int>(data, pvmd, pvpmd, t, p);
+                if (pvmd.data_type_size_in_bytes == sizeof(long))
+                    createPropertyVectorPart<long>(data, pvmd, pvpmd, t, p);
             }
             else
             {
-                if (vec_pvmd[i]->data_type_size_in_bytes ==
-                    sizeof(unsigned int))
-                    createPropertyVectorPart<unsigned int>(
-                        is, *vec_pvmd[i], pvpmd, t, global_offset, p);
-                if (vec_pvmd[i]->data_type_size_in_bytes ==
-                    sizeof(unsigned long))
-                    createPropertyVectorPart<unsigned long>(
-                        is, *vec_pvmd[i], pvpmd, t, global_offset, p);
+                if (pvmd.data_type_size_in_bytes == sizeof(unsigned int))
+                    createPropertyVectorPart<unsigned int>(data, pvmd, pvpmd,
+                                                           t, p);
+                if (pvmd.data_type_size_in_bytes == sizeof(unsigned long))
+                    createPropertyVectorPart<unsigned long>(data, pvmd, pvpmd,
+                                                            t, p);
             }
         }
         else
         {
-            if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(float))
-                createPropertyVectorPart<float>(is, *vec_pvmd[i], pvpmd, t,
-                                                global_offset, p);
-            if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(double))
-                createPropertyVectorPart<double>(is, *vec_pvmd[i], pvpmd, t,
-                                                 global_offset, p);
+            if (pvmd.data_type_size_in_bytes == sizeof(float))
+                createPropertyVectorPart<float>(data, pvmd, pvpmd, t, p);
+            if (pvmd.data_type_size_in_bytes == sizeof(double))
+                createPropertyVectorPart<double>(data, pvmd, pvpmd, t, p);
         }
-        global_offset += vec_pvmd[i]->data_type_size_in_bytes *
-                         vec_pvmd[i]->number_of_tuples *
-                         vec_pvmd[i]->number_of_components;
     }
 }
 
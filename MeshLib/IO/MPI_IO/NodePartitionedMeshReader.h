@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <cstring>
 #include <iosfwd>
 #include <string>
 #include <vector>
@@ -172,36 +173,31 @@ private:
                               MeshLib::MeshItemType t,
                               MeshLib::Properties& p) const;
 
+    /// Reads the parts of all property vectors belonging to the partition of
+    /// this process from the values file with one collective MPI-IO call.
+    /// The byte ranges of the parts in the file are combined into one derived
+    /// data type which is used as the file view.
     void readDomainSpecificPartOfPropertyVectors(
         std::vector<boost::optional<MeshLib::IO::PropertyVectorMetaData>> const&
             vec_pvmd,
         MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
         MeshLib::MeshItemType t,
-        std::istream& is,
+        std::string const& file_name,
         MeshLib::Properties& p) const;
 
     template <typename T>
     void createPropertyVectorPart(
-        std::istream& is, MeshLib::IO::PropertyVectorMetaData const& pvmd,
+        char const* const data,
+        MeshLib::IO::PropertyVectorMetaData const& pvmd,
         MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
-        MeshLib::MeshItemType t, unsigned long global_offset,
-        MeshLib::Properties& p) const
+        MeshLib::MeshItemType t, MeshLib::Properties& p) const
     {
         MeshLib::PropertyVector<T>* pv = p.createNewPropertyVector<T>(
             pvmd.property_name, t, pvmd.number_of_components);
         pv->resize(pvpmd.number_of_tuples * pvmd.number_of_components);
-        // jump to the place for reading the specific part of the
-        // PropertyVector
-        is.seekg(global_offset + pvpmd.offset * sizeof(T));
-        // read the values
-        unsigned long const number_of_bytes = pvmd.data_type_size_in_bytes *
-                                              pvpmd.number_of_tuples *
-                                              pvmd.number_of_components;
-        if (!is.read(reinterpret_cast<char*>(pv->data()), number_of_bytes))
-            OGS_FATAL(
-                "Error in NodePartitionedMeshReader::readPropertiesBinary: "
-                "Could not read part %d of the PropertyVector.",
-                _mpi_rank);
+        // The read buffer is not necessarily aligned for T, therefore the
+        // values are copied bytewise.
+        std::memcpy(pv->data(), data, pv->size() * sizeof(T));
     }
 
     /*!
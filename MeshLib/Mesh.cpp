@@ -64,6 +64,7 @@ Mesh::Mesh(std::string name,
     this->setElementNeighbors();
 
     this->calcEdgeLengthRange();
+    trackMemoryUsage();
 }
 
 Mesh::Mesh(const Mesh &mesh)
@@ -100,6 +101,26 @@ Mesh::Mesh(const Mesh &mesh)
     this->setElementsConnectedToNodes();
     //this->setNodesConnectedByElements();
     this->setElementNeighbors();
+    trackMemoryUsage();
+}
+
+void Mesh::trackMemoryUsage()
+{
+    std::size_t bytes = (_nodes.capacity() + _elements.capacity()) *
+                        sizeof(void*);
+    for (auto const* node : _nodes)
+    {
+        bytes += sizeof(Node) + (node->getConnectedNodes().capacity() +
+                                 node->getElements().capacity()) *
+                                    sizeof(void*);
+    }
+    for (auto const* element : _elements)
+    {
+        bytes += sizeof(Element) + (element->getNumberOfNodes() +
+                                    element->getNumberOfNeighbors()) *
+                                       sizeof(void*);
+    }
+    _memory.set(bytes);
 }
 
 Mesh::~Mesh()
@@ -21,6 +21,7 @@
 
 #include "BaseLib/Counter.h"
 #include "BaseLib/Error.h"
+#include "BaseLib/MemoryAccounting.h"
 
 #include "MeshEnums.h"
 #include "Properties.h"
@@ -160,6 +161,10 @@ protected:
     /// Check if the mesh contains any nonlinear element
     bool hasNonlinearElement() const;
 
+    /// Reports the memory used by the nodes and elements including their
+    /// connectivity to the memory accounting. The properties are not included.
+    void trackMemoryUsage();
+
     std::size_t const _id;
     unsigned _mesh_dimension;
     /// The minimal and maximal edge length over all elements in the mesh
@@ -173,6 +178,8 @@ protected:
     Properties _properties;
 
     bool _is_axially_symmetric = false;
+
+    BaseLib::TrackedMemory _memory{BaseLib::MemoryTag::Mesh};
 }; /* class */
 
 
@@ -0,0 +1,151 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ErrorIndicator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <Eigen/Dense>
+
+#include "BaseLib/Error.h"
+#include "MathLib/Point3d.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+std::vector<double> computeGradientErrorIndicator(
+    Mesh const& mesh, std::vector<double> const& nodal_values)
+{
+    if (nodal_values.size() != mesh.getNumberOfNodes())
+    {
+        OGS_FATAL(
+            "The number of nodal values %d differs from the number of nodes "
+            "%d of the mesh '%s'.",
+            nodal_values.size(), mesh.getNumberOfNodes(),
+            mesh.getName().c_str());
+    }
+
+    auto const& elements = mesh.getElements();
+    std::vector<double> indicator(elements.size());
+    for (std::size_t k = 0; k < elements.size(); ++k)
+    {
+        auto const& e = *elements[k];
+        auto const cell_type = e.getCellType();
+        if (cell_type != CellType::LINE2 && cell_type != CellType::TRI3 &&
+            cell_type != CellType::TET4)
+        {
+            OGS_FATAL(
+                "The gradient error indicator is implemented for linear "
+                "simplex elements only, but element %d is of type %s.",
+                k, CellType2String(cell_type).c_str());
+        }
+
+        // The gradient g of the linear interpolation in the element satisfies
+        // E^T g = du for the edge vectors E from the first node and lies in
+        // the span of E, which also holds for lower dimensional elements.
+        int const n_edges_from_first_node = e.getNumberOfBaseNodes() - 1;
+        Eigen::MatrixXd E(3, n_edges_from_first_node);
+        Eigen::VectorXd du(n_edges_from_first_node);
+        auto const& x0 = *e.getNode(0);
+        auto const u0 = nodal_values[e.getNodeIndex(0)];
+        for (int i = 0; i < n_edges_from_first_node; ++i)
+        {
+            auto const& xi = *e.getNode(i + 1);
+            for (int c = 0; c < 3; ++c)
+            {
+                E(c, i) = xi[c] - x0[c];
+            }
+            du[i] = nodal_values[e.getNodeIndex(i + 1)] - u0;
+        }
+        // The Gram determinant is at most the product of the squared edge
+        // lengths and vanishes for degenerate elements.
+        Eigen::MatrixXd const ETE = E.transpose() * E;
+        if (!(ETE.determinant() >
+              std::numeric_limits<double>::epsilon() *
+                  ETE.diagonal().prod()))
+        {
+            OGS_FATAL(
+                "The gradient error indicator cannot be computed for the "
+                "degenerate element %d of the mesh '%s'.",
+                k, mesh.getName().c_str());
+        }
+        Eigen::Vector3d const gradient = E * ETE.ldlt().solve(du);
+
+        double h2 = 0;
+        for (unsigned i = 0; i < e.getNumberOfEdges(); ++i)
+        {
+            h2 = std::max(h2, MathLib::sqrDist(*e.getEdgeNode(i, 0),
+                                               *e.getEdgeNode(i, 1)));
+        }
+        indicator[k] = std::sqrt(h2) * gradient.norm();
+    }
+    return indicator;
+}
+
+std::vector<std::size_t> markElementsForRefinement(
+    std::vector<double> const& indicator, double const theta)
+{
+    if (theta < 0 || theta > 1)
+    {
+        OGS_FATAL("The marking fraction theta must be in [0, 1], got %g.",
+                  theta);
+    }
+    if (indicator.empty())
+    {
+        return {};
+    }
+
+    double const max_indicator =
+        *std::max_element(indicator.begin(), indicator.end());
+    std::vector<std::size_t> marked_elements;
+    if (max_indicator <= 0)
+    {
+        return marked_elements;
+    }
+    for (std::size_t k = 0; k < indicator.size(); ++k)
+    {
+        if (indicator[k] >= theta * max_indicator)
+        {
+            marked_elements.push_back(k);
+        }
+    }
+    return marked_elements;
+}
+
+std::vector<std::size_t> markElementsForCoarsening(
+    std::vector<double> const& indicator, double const theta)
+{
+    if (theta < 0 || theta > 1)
+    {
+        OGS_FATAL("The marking fraction theta must be in [0, 1], got %g.",
+                  theta);
+    }
+    if (indicator.empty())
+    {
+        return {};
+    }
+
+    double const max_indicator =
+        *std::max_element(indicator.begin(), indicator.end());
+    std::vector<std::size_t> marked_elements;
+    for (std::size_t k = 0; k < indicator.size(); ++k)
+    {
+        if (indicator[k] <= theta * max_indicator)
+        {
+            marked_elements.push_back(k);
+        }
+    }
+    return marked_elements;
+}
+}  // namespace MeshLib
@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+
+/// Computes the gradient based error indicator
+/// \f[ \eta_e = h_e \, |\nabla u_h|_e \f]
+/// for each element \f$ e \f$ of a mesh consisting of lines, triangles and
+/// tetrahedra. \f$ h_e \f$ is the length of the longest edge and
+/// \f$ \nabla u_h \f$ the constant gradient of the linear interpolation of the
+/// given nodal values in the element.
+///
+/// The indicator is large where fronts of the field, e.g. of saturation or
+/// temperature, are resolved by few elements. Degenerate elements, for which
+/// the gradient is not defined, are reported by OGS_FATAL.
+std::vector<double> computeGradientErrorIndicator(
+    Mesh const& mesh, std::vector<double> const& nodal_values);
+
+/// Marks the elements for refinement by the maximum strategy, i.e., the ids of
+/// all elements with \f$ \eta_e \ge \theta \max_e \eta_e \f$ are returned.
+/// \param indicator The error indicator of each element.
+/// \param theta Fraction of the maximal indicator in [0, 1].
+std::vector<std::size_t> markElementsForRefinement(
+    std::vector<double> const& indicator, double theta);
+
+/// Marks the elements for coarsening, i.e., the ids of all elements with
+/// \f$ \eta_e \le \theta \max_e \eta_e \f$ are returned.
+/// \param indicator The error indicator of each element.
+/// \param theta Fraction of the maximal indicator in [0, 1].
+std::vector<std::size_t> markElementsForCoarsening(
+    std::vector<double> const& indicator, double theta);
+
+}  // namespace MeshLib
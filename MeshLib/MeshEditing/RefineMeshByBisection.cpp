@@ -0,0 +1,661 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "RefineMeshByBisection.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
+#include <utility>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MathLib/Point3d.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Elements/Line.h"
+#include "MeshLib/Elements/Tet.h"
+#include "MeshLib/Elements/Tri.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/DuplicateMeshComponents.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+#include "MeshLib/PropertyVector.h"
+
+namespace MeshLib
+{
+namespace
+{
+/// An edge given by the ids of its end nodes in ascending order.
+using Edge = std::pair<std::size_t, std::size_t>;
+
+/// The node ids of a simplex; each pair of nodes forms an edge.
+using Simplex = std::vector<std::size_t>;
+
+/// Orders the edges by their length and, for equal lengths, by the node ids.
+class EdgeOrder
+{
+public:
+    explicit EdgeOrder(std::vector<Node*> const& nodes) : _nodes(nodes) {}
+
+    bool operator()(Edge const& a, Edge const& b) const
+    {
+        double const length_a =
+            MathLib::sqrDist(*_nodes[a.first], *_nodes[a.second]);
+        double const length_b =
+            MathLib::sqrDist(*_nodes[b.first], *_nodes[b.second]);
+        if (length_a != length_b)
+        {
+            return length_a < length_b;
+        }
+        return a < b;
+    }
+
+private:
+    std::vector<Node*> const& _nodes;
+};
+
+/// Marks nodes, which are not created by a bisection.
+constexpr std::size_t no_node = std::numeric_limits<std::size_t>::max();
+
+Simplex getSimplex(Element const& e)
+{
+    auto const cell_type = e.getCellType();
+    if (cell_type != CellType::LINE2 && cell_type != CellType::TRI3 &&
+        cell_type != CellType::TET4)
+    {
+        OGS_FATAL(
+            "Bisection is implemented for linear simplex elements only, but "
+            "element %d is of type %s.",
+            e.getID(), CellType2String(cell_type).c_str());
+    }
+
+    Simplex simplex(e.getNumberOfBaseNodes());
+    for (std::size_t i = 0; i < simplex.size(); ++i)
+    {
+        simplex[i] = e.getNodeIndex(i);
+    }
+    return simplex;
+}
+
+std::vector<bool> getMarks(std::vector<std::size_t> const& marked_elements,
+                           std::size_t const n_elements)
+{
+    std::vector<bool> is_marked(n_elements, false);
+    for (auto const k : marked_elements)
+    {
+        if (k >= n_elements)
+        {
+            OGS_FATAL("The marked element id %d exceeds the number %d of "
+                      "elements.",
+                      k, n_elements);
+        }
+        is_marked[k] = true;
+    }
+    return is_marked;
+}
+
+/// Returns the bisected edge of each node of the mesh or {no_node, no_node}
+/// for nodes not created by a bisection.
+std::vector<Edge> getBisectionEdges(Mesh const& mesh)
+{
+    std::vector<Edge> edges(mesh.getNumberOfNodes(), Edge{no_node, no_node});
+    auto const& properties = mesh.getProperties();
+    if (!properties.existsPropertyVector<std::size_t>(
+            bisection_edge_nodes_property_name))
+    {
+        return edges;
+    }
+    auto const& edge_nodes = *properties.getPropertyVector<std::size_t>(
+        bisection_edge_nodes_property_name, MeshItemType::Node, 2);
+    for (std::size_t i = 0; i < edges.size(); ++i)
+    {
+        edges[i] = {edge_nodes.getComponent(i, 0),
+                    edge_nodes.getComponent(i, 1)};
+    }
+    return edges;
+}
+
+void addBisectionEdges(std::vector<Edge> const& edges, Properties& properties)
+{
+    auto& edge_nodes = *properties.createNewPropertyVector<std::size_t>(
+        bisection_edge_nodes_property_name, MeshItemType::Node, 2);
+    edge_nodes.reserve(2 * edges.size());
+    for (auto const& edge : edges)
+    {
+        edge_nodes.push_back(edge.first);
+        edge_nodes.push_back(edge.second);
+    }
+}
+
+template <typename Function>
+void forEachEdge(Simplex const& simplex, Function&& f)
+{
+    for (std::size_t i = 0; i < simplex.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < simplex.size(); ++j)
+        {
+            f(Edge{std::minmax(simplex[i], simplex[j])});
+        }
+    }
+}
+
+/// Bisects the simplex recursively at the greatest of its bisected edges and
+/// appends the resulting simplices.
+void bisect(Simplex const& simplex,
+            std::map<Edge, std::size_t> const& edge_middle_nodes,
+            EdgeOrder const& edge_order, std::vector<Simplex>& result)
+{
+    auto greatest = edge_middle_nodes.end();
+    forEachEdge(simplex, [&](Edge const& edge) {
+        auto const it = edge_middle_nodes.find(edge);
+        if (it != edge_middle_nodes.end() &&
+            (greatest == edge_middle_nodes.end() ||
+             edge_order(greatest->first, edge)))
+        {
+            greatest = it;
+        }
+    });
+
+    if (greatest == edge_middle_nodes.end())
+    {
+        result.push_back(simplex);
+        return;
+    }
+
+    // Replacing one end node of the edge by the middle node preserves the
+    // orientation of the simplex.
+    auto const& edge = greatest->first;
+    std::size_t const middle_node = greatest->second;
+    Simplex first = simplex;
+    std::replace(first.begin(), first.end(), edge.second, middle_node);
+    bisect(first, edge_middle_nodes, edge_order, result);
+    Simplex second = simplex;
+    std::replace(second.begin(), second.end(), edge.first, middle_node);
+    bisect(second, edge_middle_nodes, edge_order, result);
+}
+
+Element* createElement(Simplex const& simplex, std::vector<Node*> const& nodes)
+{
+    switch (simplex.size())
+    {
+        case 2:
+            return new Line(std::array<Node*, 2>{
+                {nodes[simplex[0]], nodes[simplex[1]]}});
+        case 3:
+            return new Tri(std::array<Node*, 3>{
+                {nodes[simplex[0]], nodes[simplex[1]], nodes[simplex[2]]}});
+        case 4:
+            return new Tet(std::array<Node*, 4>{
+                {nodes[simplex[0]], nodes[simplex[1]], nodes[simplex[2]],
+                 nodes[simplex[3]]}});
+        default:
+            OGS_FATAL("Cannot create a simplex with %d nodes.",
+                      simplex.size());
+    }
+}
+
+template <typename T>
+void copyFromParentElements(PropertyVector<T> const& source,
+                            std::vector<std::size_t> const& parent_elements,
+                            std::size_t const values_per_element,
+                            Properties& properties)
+{
+    auto& target = *properties.createNewPropertyVector<T>(
+        source.getPropertyName(), source.getMeshItemType(),
+        source.getNumberOfComponents());
+    target.resize(parent_elements.size() * values_per_element);
+    for (std::size_t k = 0; k < parent_elements.size(); ++k)
+    {
+        std::copy_n(source.begin() + parent_elements[k] * values_per_element,
+                    values_per_element,
+                    target.begin() + k * values_per_element);
+    }
+}
+
+template <typename T>
+bool copyCellProperty(Properties const& source_properties,
+                      std::string const& name,
+                      std::vector<std::size_t> const& parent_elements,
+                      Properties& properties)
+{
+    if (!source_properties.existsPropertyVector<T>(name))
+    {
+        return false;
+    }
+    auto const& source = *source_properties.getPropertyVector<T>(name);
+    copyFromParentElements(source, parent_elements,
+                           source.getNumberOfComponents(), properties);
+    return true;
+}
+
+void interpolateNodeProperty(PropertyVector<double> const& source,
+                             std::size_t const n_nodes,
+                             std::vector<Edge> const& middle_node_edges,
+                             Properties& properties)
+{
+    auto const n_components = source.getNumberOfComponents();
+    auto& target = *properties.createNewPropertyVector<double>(
+        source.getPropertyName(), MeshItemType::Node, n_components);
+    target.resize((n_nodes + middle_node_edges.size()) * n_components);
+    std::copy(source.begin(), source.end(), target.begin());
+    for (std::size_t j = 0; j < middle_node_edges.size(); ++j)
+    {
+        auto const& edge = middle_node_edges[j];
+        for (int c = 0; c < n_components; ++c)
+        {
+            target.getComponent(n_nodes + j, c) =
+                (source.getComponent(edge.first, c) +
+                 source.getComponent(edge.second, c)) /
+                2;
+        }
+    }
+}
+
+/// Calls the function for each node property of type double and warns about
+/// the other ones, which are not transferred.
+template <typename Function>
+void forEachDoubleNodeProperty(Properties const& source_properties,
+                               Function&& f)
+{
+    for (auto const& name :
+         source_properties.getPropertyVectorNames(MeshItemType::Node))
+    {
+        if (name == bisection_edge_nodes_property_name)
+        {
+            continue;
+        }
+        if (!source_properties.existsPropertyVector<double>(name))
+        {
+            WARN("The node property '%s' is not of type double and is not "
+                 "transferred to the new mesh.",
+                 name.c_str());
+            continue;
+        }
+        f(*source_properties.getPropertyVector<double>(name));
+    }
+}
+
+/// Copies the values of the remaining nodes.
+void restrictNodeProperty(PropertyVector<double> const& source,
+                          std::vector<std::size_t> const& remaining_nodes,
+                          Properties& properties)
+{
+    auto const n_components = source.getNumberOfComponents();
+    auto& target = *properties.createNewPropertyVector<double>(
+        source.getPropertyName(), MeshItemType::Node, n_components);
+    target.resize(remaining_nodes.size() * n_components);
+    for (std::size_t i = 0; i < remaining_nodes.size(); ++i)
+    {
+        for (int c = 0; c < n_components; ++c)
+        {
+            target.getComponent(i, c) =
+                source.getComponent(remaining_nodes[i], c);
+        }
+    }
+}
+
+/// Copies the cell and integration point properties from the given source
+/// element of each new element.
+void transferElementProperties(Mesh const& mesh,
+                               std::vector<std::size_t> const& parent_elements,
+                               Properties& properties)
+{
+    auto const& source_properties = mesh.getProperties();
+
+    for (auto const& name :
+         source_properties.getPropertyVectorNames(MeshItemType::Cell))
+    {
+        if (!copyCellProperty<double>(source_properties, name,
+                                      parent_elements, properties) &&
+            !copyCellProperty<int>(source_properties, name, parent_elements,
+                                   properties) &&
+            !copyCellProperty<std::size_t>(source_properties, name,
+                                           parent_elements, properties))
+        {
+            WARN("The cell property '%s' is of unsupported type and is not "
+                 "transferred to the new mesh.",
+                 name.c_str());
+        }
+    }
+
+    // The integration point data of an element can only be located if all
+    // elements have the same number of integration points.
+    auto const& elements = mesh.getElements();
+    bool const is_single_cell_type =
+        std::all_of(elements.begin(), elements.end(), [&](Element const* e) {
+            return e->getCellType() == elements.front()->getCellType();
+        });
+    for (auto const& name : source_properties.getPropertyVectorNames(
+             MeshItemType::IntegrationPoint))
+    {
+        if (source_properties.existsPropertyVector<char>(name))
+        {
+            // Meta data is copied unchanged.
+            auto const& source =
+                *source_properties.getPropertyVector<char>(name);
+            auto& target = *properties.createNewPropertyVector<char>(
+                name, MeshItemType::IntegrationPoint,
+                source.getNumberOfComponents());
+            target.assign(source.begin(), source.end());
+            continue;
+        }
+        if (!source_properties.existsPropertyVector<double>(name))
+        {
+            WARN("The integration point property '%s' is of unsupported type "
+                 "and is not transferred to the new mesh.",
+                 name.c_str());
+            continue;
+        }
+        auto const& source = *source_properties.getPropertyVector<double>(name);
+        if (!is_single_cell_type || source.size() % elements.size() != 0)
+        {
+            WARN("The integration point property '%s' is not transferred to "
+                 "the new mesh, because the elements have different numbers "
+                 "of integration points.",
+                 name.c_str());
+            continue;
+        }
+        copyFromParentElements(source, parent_elements,
+                               source.size() / elements.size(), properties);
+    }
+}
+}  // namespace
+
+std::unique_ptr<Mesh> refineMeshByBisection(
+    Mesh const& mesh, std::vector<std::size_t> const& marked_elements,
+    std::string const& new_mesh_name)
+{
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+    EdgeOrder const edge_order(nodes);
+
+    std::vector<Simplex> simplices;
+    simplices.reserve(elements.size());
+    std::vector<Edge> longest_edges;
+    longest_edges.reserve(elements.size());
+    std::map<Edge, std::vector<std::size_t>> edge_elements;
+    for (auto const* e : elements)
+    {
+        auto simplex = getSimplex(*e);
+        Edge longest_edge = std::minmax(simplex[0], simplex[1]);
+        forEachEdge(simplex, [&](Edge const& edge) {
+            edge_elements[edge].push_back(simplices.size());
+            longest_edge = std::max(longest_edge, edge, edge_order);
+        });
+        simplices.push_back(std::move(simplex));
+        longest_edges.push_back(longest_edge);
+    }
+
+    // Bisect the longest edges of the marked elements and, for conformity,
+    // the longest edges of all elements containing a bisected edge.
+    std::map<Edge, std::size_t> edge_middle_nodes;
+    std::vector<std::size_t> elements_to_check;
+    auto bisect_edge = [&](Edge const& edge) {
+        if (edge_middle_nodes.emplace(edge, 0).second)
+        {
+            auto const& adjacent_elements = edge_elements[edge];
+            elements_to_check.insert(elements_to_check.end(),
+                                     adjacent_elements.begin(),
+                                     adjacent_elements.end());
+        }
+    };
+    auto const is_marked = getMarks(marked_elements, elements.size());
+    for (std::size_t k = 0; k < elements.size(); ++k)
+    {
+        if (is_marked[k])
+        {
+            bisect_edge(longest_edges[k]);
+        }
+    }
+    while (!elements_to_check.empty())
+    {
+        auto const k = elements_to_check.back();
+        elements_to_check.pop_back();
+        bisect_edge(longest_edges[k]);
+    }
+
+    // Create the middle nodes.
+    auto new_nodes = copyNodeVector(nodes);
+    std::vector<Edge> middle_node_edges;
+    middle_node_edges.reserve(edge_middle_nodes.size());
+    for (auto& edge_middle_node : edge_middle_nodes)
+    {
+        auto const& a = *nodes[edge_middle_node.first.first];
+        auto const& b = *nodes[edge_middle_node.first.second];
+        edge_middle_node.second = new_nodes.size();
+        new_nodes.push_back(new Node((a[0] + b[0]) / 2, (a[1] + b[1]) / 2,
+                                     (a[2] + b[2]) / 2));
+        middle_node_edges.push_back(edge_middle_node.first);
+    }
+
+    // Bisect the elements; the children of an element are stored
+    // consecutively.
+    std::vector<Element*> new_elements;
+    std::vector<std::size_t> parent_elements;
+    std::vector<Simplex> children;
+    for (std::size_t k = 0; k < simplices.size(); ++k)
+    {
+        children.clear();
+        bisect(simplices[k], edge_middle_nodes, edge_order, children);
+        for (auto const& child : children)
+        {
+            new_elements.push_back(createElement(child, new_nodes));
+            parent_elements.push_back(k);
+        }
+    }
+
+    INFO("Refined %d marked elements of %d elements: %d new nodes, %d "
+         "elements.",
+         marked_elements.size(), elements.size(), middle_node_edges.size(),
+         new_elements.size());
+
+    auto new_mesh =
+        std::make_unique<Mesh>(new_mesh_name, new_nodes, new_elements);
+    auto& properties = new_mesh->getProperties();
+    forEachDoubleNodeProperty(
+        mesh.getProperties(), [&](PropertyVector<double> const& source) {
+            interpolateNodeProperty(source, nodes.size(), middle_node_edges,
+                                    properties);
+        });
+    transferElementProperties(mesh, parent_elements, properties);
+
+    auto bisection_edges = getBisectionEdges(mesh);
+    bisection_edges.insert(bisection_edges.end(), middle_node_edges.begin(),
+                           middle_node_edges.end());
+    addBisectionEdges(bisection_edges, properties);
+    return new_mesh;
+}
+
+std::unique_ptr<Mesh> coarsenBisectedMesh(
+    Mesh const& mesh, std::vector<std::size_t> const& marked_elements,
+    std::string const& new_mesh_name)
+{
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+    auto const is_marked = getMarks(marked_elements, elements.size());
+
+    std::vector<Simplex> simplices;
+    simplices.reserve(elements.size());
+    std::vector<std::vector<std::size_t>> node_elements(nodes.size());
+    for (auto const* e : elements)
+    {
+        auto simplex = getSimplex(*e);
+        for (auto const node_id : simplex)
+        {
+            node_elements[node_id].push_back(simplices.size());
+        }
+        simplices.push_back(std::move(simplex));
+    }
+
+    // The end nodes of a bisected edge are kept as long as the middle node
+    // exists, which undoes the bisections in reverse order.
+    auto const bisection_edges = getBisectionEdges(mesh);
+    std::vector<bool> is_edge_end(nodes.size(), false);
+    for (auto const& edge : bisection_edges)
+    {
+        if (edge.first != no_node)
+        {
+            is_edge_end[edge.first] = true;
+            is_edge_end[edge.second] = true;
+        }
+    }
+
+    auto sorted = [](Simplex simplex) {
+        std::sort(simplex.begin(), simplex.end());
+        return simplex;
+    };
+
+    // Returns the pairs of children containing the first and the second end
+    // node of the bisected edge, respectively, or nothing if the elements
+    // around the middle node are not pairwise children of its bisection.
+    auto find_children =
+        [&](std::size_t const middle_node,
+            Edge const& edge) -> std::vector<std::pair<std::size_t, std::size_t>> {
+        auto const& adjacent_elements = node_elements[middle_node];
+        std::vector<std::pair<std::size_t, std::size_t>> children;
+        for (auto const k : adjacent_elements)
+        {
+            auto const& simplex = simplices[k];
+            bool const has_first =
+                std::count(simplex.begin(), simplex.end(), edge.first) != 0;
+            bool const has_second =
+                std::count(simplex.begin(), simplex.end(), edge.second) != 0;
+            if (has_first == has_second)
+            {
+                return {};
+            }
+            if (!has_first)
+            {
+                continue;
+            }
+            Simplex sibling = simplex;
+            std::replace(sibling.begin(), sibling.end(), edge.first,
+                         edge.second);
+            sibling = sorted(sibling);
+            auto const it = std::find_if(
+                adjacent_elements.begin(), adjacent_elements.end(),
+                [&](std::size_t const l) {
+                    return sorted(simplices[l]) == sibling;
+                });
+            if (it == adjacent_elements.end())
+            {
+                return {};
+            }
+            children.emplace_back(k, *it);
+        }
+        if (2 * children.size() != adjacent_elements.size())
+        {
+            return {};
+        }
+        return children;
+    };
+
+    // Merge the children of the newest bisections first. An element is
+    // merged at most once per call.
+    std::vector<Simplex> coarsened_simplices = simplices;
+    std::vector<bool> is_merged(elements.size(), false);
+    std::vector<bool> is_removed(nodes.size(), false);
+    for (std::size_t middle_node = nodes.size(); middle_node-- > 0;)
+    {
+        auto const& edge = bisection_edges[middle_node];
+        if (edge.first == no_node || is_edge_end[middle_node])
+        {
+            continue;
+        }
+        auto const& adjacent_elements = node_elements[middle_node];
+        if (adjacent_elements.empty() ||
+            !std::all_of(adjacent_elements.begin(), adjacent_elements.end(),
+                         [&](std::size_t const k) {
+                             return is_marked[k] && !is_merged[k];
+                         }))
+        {
+            continue;
+        }
+        auto const children = find_children(middle_node, edge);
+        if (children.empty())
+        {
+            continue;
+        }
+        for (auto const& pair : children)
+        {
+            // The child containing the first end node becomes the parent,
+            // which preserves the orientation.
+            auto& parent = coarsened_simplices[pair.first];
+            std::replace(parent.begin(), parent.end(), middle_node,
+                         edge.second);
+            coarsened_simplices[pair.second].clear();
+            is_merged[pair.first] = true;
+            is_merged[pair.second] = true;
+        }
+        is_removed[middle_node] = true;
+    }
+
+    std::vector<Node*> new_nodes;
+    std::vector<std::size_t> remaining_nodes;
+    std::vector<std::size_t> new_node_ids(nodes.size(), no_node);
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (is_removed[i])
+        {
+            continue;
+        }
+        auto const& node = *nodes[i];
+        new_node_ids[i] = new_nodes.size();
+        new_nodes.push_back(new Node(node[0], node[1], node[2]));
+        remaining_nodes.push_back(i);
+    }
+
+    std::vector<Element*> new_elements;
+    std::vector<std::size_t> source_elements;
+    for (std::size_t k = 0; k < coarsened_simplices.size(); ++k)
+    {
+        auto simplex = coarsened_simplices[k];
+        if (simplex.empty())
+        {
+            continue;
+        }
+        for (auto& node_id : simplex)
+        {
+            node_id = new_node_ids[node_id];
+        }
+        new_elements.push_back(createElement(simplex, new_nodes));
+        source_elements.push_back(k);
+    }
+
+    INFO("Coarsened %d marked elements of %d elements: %d nodes removed, %d "
+         "elements.",
+         marked_elements.size(), elements.size(),
+         nodes.size() - new_nodes.size(), new_elements.size());
+
+    auto new_mesh =
+        std::make_unique<Mesh>(new_mesh_name, new_nodes, new_elements);
+    auto& properties = new_mesh->getProperties();
+    forEachDoubleNodeProperty(
+        mesh.getProperties(), [&](PropertyVector<double> const& source) {
+            restrictNodeProperty(source, remaining_nodes, properties);
+        });
+    transferElementProperties(mesh, source_elements, properties);
+
+    std::vector<Edge> new_bisection_edges;
+    new_bisection_edges.reserve(remaining_nodes.size());
+    for (auto const i : remaining_nodes)
+    {
+        auto const& edge = bisection_edges[i];
+        new_bisection_edges.push_back(
+            edge.first == no_node
+                ? edge
+                : Edge{new_node_ids[edge.first], new_node_ids[edge.second]});
+    }
+    addBisectionEdges(new_bisection_edges, properties);
+    return new_mesh;
+}
+}  // namespace MeshLib
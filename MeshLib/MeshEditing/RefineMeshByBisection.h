@@ -0,0 +1,70 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+
+/// Name of the node property of type std::size_t with two components, which
+/// stores for each node created by refineMeshByBisection() the ids of the end
+/// nodes of the bisected edge. Both components of all other nodes are
+/// std::numeric_limits<std::size_t>::max(). The property is written with the
+/// refined mesh and allows coarsenBisectedMesh() to undo the bisections.
+constexpr char bisection_edge_nodes_property_name[] = "bisection_edge_nodes";
+
+/// Refines the marked elements of a mesh consisting of lines, triangles and
+/// tetrahedra by longest edge bisection and returns the conforming refined
+/// mesh.
+///
+/// The longest edges of the marked elements are bisected. For conformity the
+/// longest edge of each element containing a bisected edge is bisected, too.
+/// Then each element is bisected recursively at the longest of its bisected
+/// edges until it contains none of them anymore. The edges are compared by
+/// length and then by node ids, such that neighbouring elements split a shared
+/// face in the same way.
+///
+/// The mesh properties are transferred to the refined mesh:
+///  - node properties of type double are interpolated linearly,
+///  - cell properties of type double, int and std::size_t are copied from the
+///    parent element,
+///  - integration point properties of type double are copied from the parent
+///    element if all elements are of the same type; other integration point
+///    properties, e.g. the meta data, are copied unchanged.
+///
+/// Other properties are not transferred. The bisected edges are recorded in
+/// the property named by #bisection_edge_nodes_property_name.
+std::unique_ptr<Mesh> refineMeshByBisection(
+    Mesh const& mesh, std::vector<std::size_t> const& marked_elements,
+    std::string const& new_mesh_name);
+
+/// Coarsens a mesh refined by refineMeshByBisection() by undoing bisections
+/// within the marked elements and returns the coarsened mesh.
+///
+/// A node created by the bisection of an edge is removed if all elements
+/// containing it are marked and pairwise children of the same bisection. The
+/// children are merged into their parent element. Nodes, which are end nodes
+/// of edges bisected later, are kept, i.e., the bisections are undone in
+/// reverse order and possibly further coarsening needs several calls.
+///
+/// The mesh properties are transferred like in refineMeshByBisection(): node
+/// properties of the remaining nodes are kept, cell and integration point
+/// properties of a merged element are copied from one of its children.
+std::unique_ptr<Mesh> coarsenBisectedMesh(
+    Mesh const& mesh, std::vector<std::size_t> const& marked_elements,
+    std::string const& new_mesh_name);
+
+}  // namespace MeshLib
@@ -8,6 +8,15 @@
 
 #include "QuadraticMeshGenerator.h"
 
+#include <array>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "MeshLib/Elements/Element.h"
 #include "MeshLib/Elements/Hex.h"
 #include "MeshLib/Elements/Line.h"
@@ -17,71 +26,98 @@
 #include "MeshLib/MeshEditing/DuplicateMeshComponents.h"
 #include "MeshLib/Node.h"
 
-/// Given an (linear) element divide all its edges by inserting a point in the
-/// middle and return a new element.
+/// Given an (linear) element return a new quadratic element with the given
+/// base nodes and middle nodes of the edges.
 template <typename QuadraticElement>
 std::unique_ptr<QuadraticElement> convertLinearToQuadratic(
-    MeshLib::Element const& e)
+    MeshLib::Element const& e,
+    std::vector<MeshLib::Node*> const& base_nodes,
+    MeshLib::Node* const* const edge_nodes)
 {
     int const n_all_nodes = QuadraticElement::n_all_nodes;
     int const n_base_nodes = QuadraticElement::n_base_nodes;
     assert(n_base_nodes == e.getNumberOfBaseNodes());
 
-    // Copy base nodes of element to the quadratic element new nodes'.
     std::array<MeshLib::Node*, n_all_nodes> nodes;
     for (int i = 0; i < n_base_nodes; i++)
     {
-        nodes[i] = const_cast<MeshLib::Node*>(e.getNode(i));
+        nodes[i] = base_nodes[e.getNodeIndex(i)];
     }
 
-    // For each edge create a middle node.
     int const number_of_edges = e.getNumberOfEdges();
     for (int i = 0; i < number_of_edges; i++)
     {
-        auto const& a = *e.getEdgeNode(i, 0);
-        auto const& b = *e.getEdgeNode(i, 1);
-
-        nodes[n_base_nodes + i] = new MeshLib::Node(
-            (a[0] + b[0]) / 2, (a[1] + b[1]) / 2, (a[2] + b[2]) / 2);
+        nodes[n_base_nodes + i] = edge_nodes[i];
     }
 
     return std::make_unique<QuadraticElement>(nodes, e.getID());
 }
 
+/// Checks if the element can be converted by createQuadraticElement().
+void checkElementType(MeshLib::Element const& e)
+{
+    switch (e.getCellType())
+    {
+        case MeshLib::CellType::LINE2:
+        case MeshLib::CellType::TRI3:
+        case MeshLib::CellType::TET4:
+        case MeshLib::CellType::QUAD4:
+        case MeshLib::CellType::HEX8:
+            return;
+        default:
+            OGS_FATAL("Mesh element type %s is not supported",
+                      MeshLib::CellType2String(e.getCellType()).c_str());
+    }
+}
+
 /// Return a new quadratic element corresponding to the linear element's type.
 std::unique_ptr<MeshLib::Element> createQuadraticElement(
-    MeshLib::Element const& e)
+    MeshLib::Element const& e,
+    std::vector<MeshLib::Node*> const& base_nodes,
+    MeshLib::Node* const* const edge_nodes)
 {
     if (e.getCellType() == MeshLib::CellType::LINE2)
     {
-        return convertLinearToQuadratic<MeshLib::Line3>(e);
+        return convertLinearToQuadratic<MeshLib::Line3>(e, base_nodes,
+                                                        edge_nodes);
     }
     if (e.getCellType() == MeshLib::CellType::TRI3)
     {
-        return convertLinearToQuadratic<MeshLib::Tri6>(e);
+        return convertLinearToQuadratic<MeshLib::Tri6>(e, base_nodes,
+                                                       edge_nodes);
     }
     if (e.getCellType() == MeshLib::CellType::TET4)
     {
-        return convertLinearToQuadratic<MeshLib::Tet10>(e);
+        return convertLinearToQuadratic<MeshLib::Tet10>(e, base_nodes,
+                                                        edge_nodes);
     }
     if (e.getCellType() == MeshLib::CellType::QUAD4)
     {
-        return convertLinearToQuadratic<MeshLib::Quad8>(e);
+        return convertLinearToQuadratic<MeshLib::Quad8>(e, base_nodes,
+                                                        edge_nodes);
     }
     if (e.getCellType() == MeshLib::CellType::HEX8)
     {
-        return convertLinearToQuadratic<MeshLib::Hex20>(e);
+        return convertLinearToQuadratic<MeshLib::Hex20>(e, base_nodes,
+                                                        edge_nodes);
     }
 
     OGS_FATAL("Mesh element type %s is not supported",
               MeshLib::CellType2String(e.getCellType()).c_str());
 }
 
-struct nodeByCoordinatesComparator
+/// An edge given by the ids of its end nodes in ascending order.
+using Edge = std::pair<std::size_t, std::size_t>;
+
+struct EdgeHash
 {
-    bool operator()(MeshLib::Node* a, MeshLib::Node* b) const
+    std::size_t operator()(Edge const& edge) const
     {
-        return *a < *b;
+        // Combination of the hashes as in boost::hash_combine.
+        std::size_t seed = std::hash<std::size_t>{}(edge.first);
+        seed ^= std::hash<std::size_t>{}(edge.second) + 0x9e3779b9 +
+                (seed << 6) + (seed >> 2);
+        return seed;
     }
 };
 
@@ -89,53 +125,113 @@ namespace MeshLib
 {
 std::unique_ptr<Mesh> createQuadraticOrderMesh(Mesh const& linear_mesh)
 {
-    // Clone the linear mesh nodes.
-    auto quadratic_mesh_nodes = MeshLib::copyNodeVector(linear_mesh.getNodes());
+    auto const& linear_mesh_elements = linear_mesh.getElements();
+    auto const number_of_elements =
+        static_cast<std::ptrdiff_t>(linear_mesh_elements.size());
 
-    // Temporary container for unique quadratic nodes with O(log(n)) search.
-    std::set<MeshLib::Node*, nodeByCoordinatesComparator> unique_nodes;
+    // The edges of all elements are stored consecutively, the edges of the
+    // k-th element start at edge_offsets[k].
+    std::vector<std::size_t> edge_offsets(number_of_elements + 1, 0);
+    for (std::ptrdiff_t k = 0; k < number_of_elements; ++k)
+    {
+        checkElementType(*linear_mesh_elements[k]);
+        edge_offsets[k + 1] =
+            edge_offsets[k] + linear_mesh_elements[k]->getNumberOfEdges();
+    }
+    auto const number_of_element_edges =
+        static_cast<std::ptrdiff_t>(edge_offsets.back());
 
-    // Create new elements with the quadratic nodes
-    std::vector<MeshLib::Element*> quadratic_elements;
-    auto const& linear_mesh_elements = linear_mesh.getElements();
-    for (MeshLib::Element const* e : linear_mesh_elements)
+    std::vector<Edge> edges(number_of_element_edges);
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < number_of_elements; ++k)
     {
-        auto quadratic_element = createQuadraticElement(*e);
+        auto const& e = *linear_mesh_elements[k];
+        int const number_of_edges = e.getNumberOfEdges();
+        for (int i = 0; i < number_of_edges; ++i)
+        {
+            auto const a = e.getEdgeNode(i, 0)->getID();
+            auto const b = e.getEdgeNode(i, 1)->getID();
+            edges[edge_offsets[k] + i] = std::minmax(a, b);
+        }
+    }
 
-        // Replace the base nodes with cloned linear nodes.
-        int const number_base_nodes = quadratic_element->getNumberOfBaseNodes();
-        for (int i = 0; i < number_base_nodes; ++i)
+    // The edges shared by several elements are identified by a hash map. The
+    // map is split into shards by the hash of the edges, which are filled
+    // concurrently.
+    int number_of_shards = 1;
+#ifdef _OPENMP
+    number_of_shards = omp_get_max_threads();
+#endif
+    std::vector<std::vector<std::size_t>> shard_edges(number_of_shards);
+    for (std::ptrdiff_t i = 0; i < number_of_element_edges; ++i)
+    {
+        shard_edges[EdgeHash{}(edges[i]) % number_of_shards].push_back(i);
+    }
+
+    // For each element edge the index of its first occurrence.
+    std::vector<std::size_t> first_occurrence(number_of_element_edges);
+#pragma omp parallel for schedule(static, 1)
+    for (int shard = 0; shard < number_of_shards; ++shard)
+    {
+        std::unordered_map<Edge, std::size_t, EdgeHash> edge_map;
+        edge_map.reserve(shard_edges[shard].size());
+        for (auto const i : shard_edges[shard])
         {
-            quadratic_element->setNode(
-                i, quadratic_mesh_nodes[quadratic_element->getNodeIndex(i)]);
+            first_occurrence[i] = edge_map.emplace(edges[i], i).first->second;
         }
+    }
 
-        // Make the new (middle-edge) nodes unique.
-        int const number_all_nodes = quadratic_element->getNumberOfNodes();
-        for (int i = number_base_nodes; i < number_all_nodes; ++i)
+    // Clone the linear mesh nodes. The middle nodes are appended in the
+    // order of the first occurrence of the edges, which is independent of the
+    // number of threads.
+    auto quadratic_mesh_nodes = MeshLib::copyNodeVector(linear_mesh.getNodes());
+    std::size_t const number_of_base_nodes = quadratic_mesh_nodes.size();
+
+    std::vector<std::size_t> edge_node_ids(number_of_element_edges);
+    std::vector<std::size_t> unique_edges;
+    for (std::ptrdiff_t i = 0; i < number_of_element_edges; ++i)
+    {
+        if (first_occurrence[i] == static_cast<std::size_t>(i))
+        {
+            edge_node_ids[i] = number_of_base_nodes + unique_edges.size();
+            unique_edges.push_back(i);
+        }
+        else
         {
-            Node* original_node =
-                const_cast<Node*>(quadratic_element->getNode(i));
-
-            auto it = unique_nodes.insert(original_node);
-            if (!it.second)  // same node was already inserted before, no
-                             // insertion
-            {
-                // Replace the element's node with the unique node.
-                quadratic_element->setNode(i, *it.first);
-                // And delete the original node
-                delete original_node;
-            }
+            edge_node_ids[i] = edge_node_ids[first_occurrence[i]];
         }
+    }
 
-        quadratic_elements.push_back(quadratic_element.release());
+    auto const number_of_edge_nodes =
+        static_cast<std::ptrdiff_t>(unique_edges.size());
+    quadratic_mesh_nodes.resize(number_of_base_nodes + number_of_edge_nodes);
+#pragma omp parallel for
+    for (std::ptrdiff_t j = 0; j < number_of_edge_nodes; ++j)
+    {
+        auto const& edge = edges[unique_edges[j]];
+        auto const& a = *linear_mesh.getNode(edge.first);
+        auto const& b = *linear_mesh.getNode(edge.second);
+        quadratic_mesh_nodes[number_of_base_nodes + j] = new MeshLib::Node(
+            (a[0] + b[0]) / 2, (a[1] + b[1]) / 2, (a[2] + b[2]) / 2);
     }
 
-    // Add the unique quadratic nodes to the cloned linear nodes.
-    quadratic_mesh_nodes.reserve(linear_mesh.getNodes().size() +
-                                 unique_nodes.size());
-    std::copy(unique_nodes.begin(), unique_nodes.end(),
-              std::back_inserter(quadratic_mesh_nodes));
+    // Create new elements with the quadratic nodes
+    std::vector<MeshLib::Element*> quadratic_elements(number_of_elements);
+#pragma omp parallel for
+    for (std::ptrdiff_t k = 0; k < number_of_elements; ++k)
+    {
+        auto const& e = *linear_mesh_elements[k];
+        std::array<MeshLib::Node*, MeshLib::Hex20::n_all_nodes> edge_nodes;
+        int const number_of_edges = e.getNumberOfEdges();
+        for (int i = 0; i < number_of_edges; ++i)
+        {
+            edge_nodes[i] =
+                quadratic_mesh_nodes[edge_node_ids[edge_offsets[k] + i]];
+        }
+        quadratic_elements[k] =
+            createQuadraticElement(e, quadratic_mesh_nodes, edge_nodes.data())
+                .release();
+    }
 
     return std::make_unique<MeshLib::Mesh>(
         linear_mesh.getName(), quadratic_mesh_nodes, quadratic_elements,
@@ -0,0 +1,76 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+namespace NumLib
+{
+/// Counterpart of the SerialExecutor distributing the loop iterations among
+/// OpenMP threads. Without OpenMP it behaves exactly like the SerialExecutor.
+///
+/// The called methods must be safe to be executed concurrently. In
+/// particular, additions of local contributions to shared global matrices
+/// and vectors must be wrapped in executeExclusively().
+struct ParallelExecutor
+{
+    /// Executes the given \c method on each element of the input \c container
+    /// concurrently.
+    ///
+    /// If any call throws, the first caught exception is rethrown after all
+    /// iterations have been finished.
+    ///
+    /// \see SerialExecutor::executeMemberOnDereferenced()
+    template <typename Container, typename Method, typename... Args>
+    static void executeMemberOnDereferenced(Method method,
+                                            Container const& container,
+                                            Args&&... args)
+    {
+        std::exception_ptr exception;
+        auto const n = static_cast<std::ptrdiff_t>(container.size());
+
+#pragma omp parallel for schedule(dynamic, 16)
+        for (std::ptrdiff_t i = 0; i < n; i++)
+        {
+            try
+            {
+                ((*container[i]).*method)(static_cast<std::size_t>(i),
+                                          args...);
+            }
+            catch (...)
+            {
+#pragma omp critical(ogs_parallel_executor_exception)
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /// Executes \c f by one thread at a time. Used to serialize the
+    /// assembly of local contributions into shared global data.
+    template <typename F>
+    static void executeExclusively(F&& f)
+    {
+#pragma omp critical(ogs_parallel_executor_exclusive)
+        std::forward<F>(f)();
+    }
+};
+
+}  // namespace NumLib
@@ -11,6 +11,8 @@
 #include "DOFTableUtil.h"
 #include <cassert>
 
+#include <Eigen/Core>
+
 namespace NumLib
 {
 namespace
@@ -86,6 +88,35 @@ double normInfinity(GlobalVector const& x, unsigned const global_component,
 #endif
     return res;
 }
+
+//! Gathers the values of each component and reduces them to a partial (i.e.,
+//! process local and, for the 2-norm, not yet square-rooted) norm.
+template <typename ReduceComponent>
+std::vector<double> partialNorms(
+    GlobalVector const& x,
+    std::vector<std::vector<GlobalIndexType>> const& component_indices,
+    ReduceComponent reduce_component)
+{
+    std::vector<double> res;
+    res.reserve(component_indices.size());
+    for (auto const& indices : component_indices)
+    {
+        auto const values = x.get(indices);
+        res.push_back(reduce_component(Eigen::Map<Eigen::VectorXd const>(
+            values.data(), values.size())));
+    }
+    return res;
+}
+
+#ifdef USE_PETSC
+void allReduce(std::vector<double>& res, MPI_Op const op)
+{
+    std::vector<double> global_result(res.size());
+    MPI_Allreduce(res.data(), global_result.data(), res.size(), MPI_DOUBLE,
+                  op, PETSC_COMM_WORLD);
+    res = std::move(global_result);
+}
+#endif
 }  // anonymous namespace
 
 double getNonGhostNodalValue(GlobalVector const& x, MeshLib::Mesh const& mesh,
@@ -177,4 +208,86 @@ double norm(GlobalVector const& x, unsigned const global_component,
     }
 }
 
+std::vector<std::vector<GlobalIndexType>> getNonGhostComponentIndices(
+    LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
+{
+    std::vector<std::vector<GlobalIndexType>> component_indices(
+        dof_table.getNumberOfComponents());
+
+    for (int c = 0; c < dof_table.getNumberOfComponents(); ++c)
+    {
+        auto const& ms = dof_table.getMeshSubset(c);
+        assert(ms.getMeshID() == mesh.getID());
+
+        auto& indices = component_indices[c];
+        indices.reserve(ms.getNumberOfNodes());
+        for (MeshLib::Node const* node : ms.getNodes())
+        {
+            MeshLib::Location const l{
+                mesh.getID(), MeshLib::MeshItemType::Node, node->getID()};
+            auto const index = dof_table.getGlobalIndex(l, c);
+            assert(index != NumLib::MeshComponentMap::nop);
+
+            if (index < 0)
+            {  // ghost node value
+                continue;
+            }
+            indices.push_back(index);
+        }
+    }
+
+    return component_indices;
+}
+
+std::vector<double> norms(
+    GlobalVector const& x,
+    std::vector<std::vector<GlobalIndexType>> const& component_indices,
+    MathLib::VecNormType norm_type)
+{
+#ifdef USE_PETSC
+    x.setLocalAccessibleVector();
+#endif
+
+    switch (norm_type)
+    {
+        case MathLib::VecNormType::NORM1:
+        {
+            auto res = partialNorms(x, component_indices, [](auto const& v) {
+                return v.template lpNorm<1>();
+            });
+#ifdef USE_PETSC
+            allReduce(res, MPI_SUM);
+#endif
+            return res;
+        }
+        case MathLib::VecNormType::NORM2:
+        {
+            auto res = partialNorms(x, component_indices, [](auto const& v) {
+                return v.squaredNorm();
+            });
+#ifdef USE_PETSC
+            allReduce(res, MPI_SUM);
+#endif
+            for (auto& r : res)
+            {
+                r = std::sqrt(r);
+            }
+            return res;
+        }
+        case MathLib::VecNormType::INFINITY_N:
+        {
+            auto res = partialNorms(x, component_indices, [](auto const& v) {
+                return v.size() == 0 ? 0.0
+                                     : v.template lpNorm<Eigen::Infinity>();
+            });
+#ifdef USE_PETSC
+            allReduce(res, MPI_MAX);
+#endif
+            return res;
+        }
+        default:
+            OGS_FATAL("An invalid norm type has been passed.");
+    }
+}
+
 }  // namespace NumLib
@@ -51,6 +51,22 @@ double norm(GlobalVector const& x, unsigned const global_component,
             MathLib::VecNormType norm_type,
             LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
 
+//! Returns for each global component the global indices of all non-ghost nodes
+//! of the component's mesh subset.
+//! The result only depends on the d.o.f. table and can be reused for norm
+//! computations of arbitrary many vectors sharing that d.o.f. table.
+std::vector<std::vector<GlobalIndexType>> getNonGhostComponentIndices(
+    LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
+
+//! Computes the specified norm of all global components of the given vector x
+//! in a single pass.
+//! \param component_indices as returned by getNonGhostComponentIndices().
+//! \return a vector of norms, one entry per global component.
+std::vector<double> norms(
+    GlobalVector const& x,
+    std::vector<std::vector<GlobalIndexType>> const& component_indices,
+    MathLib::VecNormType norm_type);
+
 /// Copies part of a global vector for the given variable into output_vector
 /// while applying a function to each value.
 ///
@@ -147,6 +147,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
                               global_component_id);
         }
     }
+
+    trackMemoryUsage();
 }
 
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
@@ -191,6 +193,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
                 mesh_id, global_component_id, global_component_id);
         }
     }
+
+    trackMemoryUsage();
 }
 
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
@@ -224,6 +228,22 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
         findGlobalIndices(elements.cbegin(), elements.cend(), ms.getNodes(),
                           mesh_id, global_component_ids[i], i);
     }
+
+    trackMemoryUsage();
+}
+
+void LocalToGlobalIndexMap::trackMemoryUsage()
+{
+    std::size_t bytes = _rows.size() * sizeof(LineIndex);
+    for (Eigen::Index i = 0; i < _rows.size(); ++i)
+    {
+        bytes += _rows.data()[i].capacity() * sizeof(GlobalIndexType);
+    }
+    // Each entry of the mesh component map is linked into four ordered
+    // indices with three pointers each.
+    bytes += _mesh_component_map.dofSizeWithGhosts() *
+             (sizeof(detail::Line) + 12 * sizeof(void*));
+    _memory.set(bytes);
 }
 
 LocalToGlobalIndexMap* LocalToGlobalIndexMap::deriveBoundaryConstrainedMap(
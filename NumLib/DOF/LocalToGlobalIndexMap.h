@@ -18,6 +18,7 @@
 
 #include <Eigen/Dense>
 
+#include "BaseLib/MemoryAccounting.h"
 #include "MathLib/LinAlg/RowColumnIndices.h"
 
 #include "MeshComponentMap.h"
@@ -185,6 +186,10 @@ private:
                            std::size_t const mesh_id, const int comp_id,
                            const int comp_id_write);
 
+    /// Reports the memory used by the index table and the mesh component map
+    /// to the memory accounting.
+    void trackMemoryUsage();
+
     template <typename ElementIterator>
     void findGlobalIndicesWithElementID(
         ElementIterator first, ElementIterator last,
@@ -205,6 +210,8 @@ private:
     Table const& _columns = _rows;
 
     std::vector<int> const _variable_component_offsets;
+
+    BaseLib::TrackedMemory _memory{BaseLib::MemoryTag::DOFTables};
 #ifndef NDEBUG
     /// Prints first rows of the table, every line, and the mesh component map.
     friend std::ostream& operator<<(std::ostream& os, LocalToGlobalIndexMap const& map);
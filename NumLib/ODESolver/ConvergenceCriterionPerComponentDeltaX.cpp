@@ -50,14 +50,14 @@ void ConvergenceCriterionPerComponentDeltaX::checkDeltaX(
     bool satisfied_abs = true;
     bool satisfied_rel = true;
 
+    auto const error_dxs = norms(minus_delta_x, _component_indices, _norm_type);
+    auto const norms_x = norms(x, _component_indices, _norm_type);
+
     for (unsigned global_component = 0; global_component < _abstols.size();
          ++global_component)
     {
-        // TODO short cut if tol <= 0.0
-        auto error_dx = norm(minus_delta_x, global_component, _norm_type,
-                             *_dof_table, *_mesh);
-        auto norm_x =
-            norm(x, global_component, _norm_type, *_dof_table, *_mesh);
+        auto const error_dx = error_dxs[global_component];
+        auto const norm_x = norms_x[global_component];
 
         INFO(
             "Convergence criterion, component %u: |dx|=%.4e, |x|=%.4e, "
@@ -88,6 +88,8 @@ void ConvergenceCriterionPerComponentDeltaX::setDOFTable(
             "The number of components in the DOF table and the number of "
             "tolerances given do not match.");
     }
+
+    _component_indices = getNonGhostComponentIndices(dof_table, mesh);
 }
 
 std::unique_ptr<ConvergenceCriterionPerComponentDeltaX>
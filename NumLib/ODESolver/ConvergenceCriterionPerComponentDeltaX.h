@@ -49,6 +49,9 @@ private:
     const std::vector<double> _reltols;
     LocalToGlobalIndexMap const* _dof_table = nullptr;
     MeshLib::Mesh const* _mesh = nullptr;
+    //! Global indices of the non-ghost nodes for each component; computed
+    //! once when the d.o.f. table is set.
+    std::vector<std::vector<GlobalIndexType>> _component_indices;
 };
 
 std::unique_ptr<ConvergenceCriterionPerComponentDeltaX>
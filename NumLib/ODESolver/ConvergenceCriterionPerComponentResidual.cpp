@@ -49,19 +49,19 @@ void ConvergenceCriterionPerComponentResidual::checkDeltaX(
         OGS_FATAL("D.o.f. table or mesh have not been set.");
     }
 
+    auto const error_dxs = norms(minus_delta_x, _component_indices, _norm_type);
+    auto const norms_x = norms(x, _component_indices, _norm_type);
+
     for (unsigned global_component = 0; global_component < _abstols.size();
          ++global_component)
     {
-        // TODO short cut if tol <= 0.0
-        auto error_dx = norm(minus_delta_x, global_component, _norm_type,
-                             *_dof_table, *_mesh);
-        auto norm_x =
-            norm(x, global_component, _norm_type, *_dof_table, *_mesh);
+        auto const error_dx = error_dxs[global_component];
+        auto const norm_x = norms_x[global_component];
 
         INFO(
             "Convergence criterion, component %u: |dx|=%.4e, |x|=%.4e, "
             "|dx|/|x|=%.4e",
-            error_dx, global_component, norm_x,
+            global_component, error_dx, norm_x,
             (norm_x == 0. ? std::numeric_limits<double>::quiet_NaN()
                           : (error_dx / norm_x)));
     }
@@ -81,12 +81,12 @@ void ConvergenceCriterionPerComponentResidual::checkResidual(
     // not satisfied.
     bool satisfied_rel = !_is_first_iteration;
 
+    auto const norms_res = norms(residual, _component_indices, _norm_type);
+
     for (unsigned global_component = 0; global_component < _abstols.size();
          ++global_component)
     {
-        // TODO short cut if tol <= 0.0
-        auto norm_res = norm(residual, global_component, _norm_type,
-                             *_dof_table, *_mesh);
+        auto const norm_res = norms_res[global_component];
 
         if (_is_first_iteration) {
             INFO("Convergence criterion, component %u: |r0|=%.4e", global_component, norm_res);
@@ -124,6 +124,8 @@ void ConvergenceCriterionPerComponentResidual::setDOFTable(
             "The number of components in the DOF table and the number of "
             "tolerances given do not match.");
     }
+
+    _component_indices = getNonGhostComponentIndices(dof_table, mesh);
 }
 
 std::unique_ptr<ConvergenceCriterionPerComponentResidual>
@@ -0,0 +1,105 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "DiscreteAdjointSolver.h"
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/RunTime.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+
+namespace NumLib
+{
+void DiscreteAdjointSolver::recordTimeStep(
+    GlobalVector const& x, GlobalMatrix const& jacobian,
+    GlobalMatrix const& jacobian_previous_state)
+{
+    using MatrixTraits = MathLib::MatrixVectorTraits<GlobalMatrix>;
+
+    TimeStepData data;
+    data.x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(x);
+
+    data.jacobian_transposed = MatrixTraits::newInstance(jacobian);
+    MathLib::LinAlg::transpose(jacobian, *data.jacobian_transposed);
+
+    data.jacobian_previous_state_transposed =
+        MatrixTraits::newInstance(jacobian_previous_state);
+    MathLib::LinAlg::transpose(jacobian_previous_state,
+                               *data.jacobian_previous_state_transposed);
+
+    _time_steps.push_back(std::move(data));
+}
+
+std::vector<double> DiscreteAdjointSolver::computeGradient(
+    ObjectiveStateDerivative const& objective_state_derivative,
+    ResidualParameterDerivative const& residual_parameter_derivative,
+    std::size_t const number_of_parameters)
+{
+    namespace LinAlg = MathLib::LinAlg;
+    using VectorTraits = MathLib::MatrixVectorTraits<GlobalVector>;
+
+    std::vector<double> gradient(number_of_parameters, 0.0);
+    if (_time_steps.empty())
+    {
+        return gradient;
+    }
+
+    BaseLib::RunTime time_adjoint;
+    time_adjoint.start();
+
+    auto const& x_last = *_time_steps.back().x;
+    auto rhs = VectorTraits::newInstance(x_last);
+    auto lambda = VectorTraits::newInstance(x_last);
+    auto tmp = VectorTraits::newInstance(x_last);
+    auto dR_dp = VectorTraits::newInstance(x_last);
+
+    for (std::size_t n = _time_steps.size(); n-- > 0;)
+    {
+        auto const& step = _time_steps[n];
+
+        // rhs = dF/dx_n - (dR_{n+1}/dx_n)^T lambda_{n+1}
+        rhs->setZero();
+        objective_state_derivative(n, *step.x, *rhs);
+        if (n + 1 < _time_steps.size())
+        {
+            LinAlg::matMult(
+                *_time_steps[n + 1].jacobian_previous_state_transposed,
+                *lambda, *tmp);
+            LinAlg::axpy(*rhs, -1.0, *tmp);
+        }
+        LinAlg::finalizeAssembly(*rhs);
+
+        // The previous adjoint solution is the initial guess.
+        if (!_linear_solver.solve(*step.jacobian_transposed, *rhs, *lambda))
+        {
+            OGS_FATAL(
+                "The linear solver failed in the adjoint solve of time step "
+                "%d.",
+                n);
+        }
+
+        for (std::size_t i = 0; i < number_of_parameters; ++i)
+        {
+            dR_dp->setZero();
+            residual_parameter_derivative(n, *step.x, i, *dR_dp);
+            LinAlg::finalizeAssembly(*dR_dp);
+            gradient[i] -= LinAlg::dot(*lambda, *dR_dp);
+        }
+    }
+
+    INFO("[time] Adjoint gradient computation took %g s.",
+         time_adjoint.elapsed());
+
+    return gradient;
+}
+
+}  // namespace NumLib
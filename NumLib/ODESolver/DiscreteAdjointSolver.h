@@ -0,0 +1,113 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "NumLib/NumericsConfig.h"
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+/*! Discrete adjoint sensitivity analysis of a sequence of implicit time steps.
+ *
+ * Each time step \f$ n = 1, \dots, N \f$ solves the residual equation
+ * \f$ R_n(x_n, x_{n-1}, p) = 0 \f$ for the state \f$ x_n \f$, where \f$ p \f$
+ * are the model parameters. For an objective function
+ * \f$ F(x_1, \dots, x_N) \f$, e.g., a misfit to monitoring data, the
+ * gradient with respect to the parameters is
+ * \f[
+ *   \frac{\mathrm dF}{\mathrm dp} = - \sum_{n=1}^N \lambda_n^T
+ *     \frac{\partial R_n}{\partial p},
+ * \f]
+ * where the adjoint vectors \f$ \lambda_n \f$ are computed backward in time
+ * from
+ * \f[
+ *   \left(\frac{\partial R_n}{\partial x_n}\right)^T \lambda_n =
+ *     \left(\frac{\partial F}{\partial x_n}\right)^T
+ *     - \left(\frac{\partial R_{n+1}}{\partial x_n}\right)^T \lambda_{n+1},
+ *   \quad \lambda_{N+1} = 0.
+ * \f]
+ *
+ * The cost of the gradient is one linear solve per time step, independent of
+ * the number of parameters.
+ *
+ * During the forward run the converged Jacobians \f$ \partial R_n / \partial
+ * x_n \f$ (the Newton Jacobian) and \f$ \partial R_n / \partial x_{n-1} \f$
+ * (e.g., \f$ -M/\Delta t \f$ for the backward Euler scheme) have to be
+ * recorded for each time step via recordTimeStep(). Note that the transposed
+ * matrices are stored, i.e., memory grows linearly with the number of time
+ * steps.
+ */
+class DiscreteAdjointSolver final
+{
+public:
+    //! Computes \f$ \partial F / \partial x_n \f$ for the given time step and
+    //! the state \f$ x_n \f$.
+    using ObjectiveStateDerivative =
+        std::function<void(std::size_t const time_step, GlobalVector const& x,
+                           GlobalVector& dF_dx)>;
+
+    //! Computes \f$ \partial R_n / \partial p_i \f$ for the given time step,
+    //! the state \f$ x_n \f$ and the parameter \f$ i \f$.
+    using ResidualParameterDerivative =
+        std::function<void(std::size_t const time_step, GlobalVector const& x,
+                           std::size_t const parameter, GlobalVector& dR_dp)>;
+
+    explicit DiscreteAdjointSolver(GlobalLinearSolver& linear_solver)
+        : _linear_solver(linear_solver)
+    {
+    }
+
+    /*! Stores the data of a converged time step needed for the backward run.
+     *
+     * \param x the converged solution \f$ x_n \f$.
+     * \param jacobian \f$ \partial R_n / \partial x_n \f$.
+     * \param jacobian_previous_state \f$ \partial R_n / \partial x_{n-1} \f$.
+     */
+    void recordTimeStep(GlobalVector const& x, GlobalMatrix const& jacobian,
+                        GlobalMatrix const& jacobian_previous_state);
+
+    std::size_t getNumberOfTimeSteps() const { return _time_steps.size(); }
+
+    /*! Runs the adjoint equations backward in time and returns the gradient
+     * \f$ \mathrm dF / \mathrm dp \f$ for \c number_of_parameters parameters.
+     *
+     * Explicit dependencies of the objective function on the parameters are
+     * not taken into account and have to be added by the caller.
+     */
+    std::vector<double> computeGradient(
+        ObjectiveStateDerivative const& objective_state_derivative,
+        ResidualParameterDerivative const& residual_parameter_derivative,
+        std::size_t const number_of_parameters);
+
+    //! Releases all recorded time steps.
+    void clear() { _time_steps.clear(); }
+
+private:
+    struct TimeStepData
+    {
+        std::unique_ptr<GlobalVector> x;
+        std::unique_ptr<GlobalMatrix> jacobian_transposed;
+        std::unique_ptr<GlobalMatrix> jacobian_previous_state_transposed;
+    };
+
+    GlobalLinearSolver& _linear_solver;
+    std::vector<TimeStepData> _time_steps;
+};
+
+//! @}
+
+}  // namespace NumLib
@@ -0,0 +1,220 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "FixedPointAcceleration.h"
+
+#include <Eigen/Dense>
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+
+namespace NumLib
+{
+AitkenRelaxation::AitkenRelaxation(double const initial_relaxation)
+    : _initial_relaxation(initial_relaxation), _relaxation(initial_relaxation)
+{
+}
+
+void AitkenRelaxation::reset()
+{
+    _relaxation = _initial_relaxation;
+    _dx_previous.reset();
+}
+
+void AitkenRelaxation::accelerate(GlobalVector& x, GlobalVector const& dx)
+{
+    namespace LinAlg = MathLib::LinAlg;
+    using VectorTraits = MathLib::MatrixVectorTraits<GlobalVector>;
+
+    if (_dx_previous)
+    {
+        // The relaxation factor is invariant under the sign of the residual,
+        // hence dx is used in place of r.
+        LinAlg::copy(dx, *_ddx);
+        LinAlg::axpy(*_ddx, -1.0, *_dx_previous);
+        double const ddx_norm2 = LinAlg::dot(*_ddx, *_ddx);
+        if (ddx_norm2 > 0)
+        {
+            _relaxation *= -LinAlg::dot(*_dx_previous, *_ddx) / ddx_norm2;
+        }
+        LinAlg::copy(dx, *_dx_previous);
+    }
+    else
+    {
+        _dx_previous = VectorTraits::newInstance(dx);
+        _ddx = VectorTraits::newInstance(dx);
+    }
+    DBUG("Aitken relaxation factor: %g", _relaxation);
+
+    // x_{k+1} = x_k + omega r_k = G(x_k) + (1 - omega) dx
+    LinAlg::axpy(x, 1.0 - _relaxation, dx);
+}
+
+AndersonAcceleration::AndersonAcceleration(int const history_size,
+                                           double const relaxation)
+    : _history_size(history_size), _relaxation(relaxation)
+{
+    if (history_size < 1)
+    {
+        OGS_FATAL(
+            "The history size of the Anderson acceleration must be at least 1, "
+            "%d was given.",
+            history_size);
+    }
+    if (relaxation <= 0 || relaxation > 1)
+    {
+        OGS_FATAL(
+            "The relaxation factor of the Anderson acceleration must be in "
+            "(0, 1], %g was given.",
+            relaxation);
+    }
+}
+
+void AndersonAcceleration::reset()
+{
+    _g_previous.reset();
+    _dx_previous.reset();
+    _delta_g.clear();
+    _delta_dx.clear();
+}
+
+void AndersonAcceleration::accelerate(GlobalVector& x, GlobalVector const& dx)
+{
+    namespace LinAlg = MathLib::LinAlg;
+    using VectorTraits = MathLib::MatrixVectorTraits<GlobalVector>;
+
+    if (!_g_previous)
+    {
+        _g_previous = VectorTraits::newInstance(x);
+        _dx_previous = VectorTraits::newInstance(dx);
+        // Plain relaxation in the first iteration.
+        LinAlg::axpy(x, 1.0 - _relaxation, dx);
+        return;
+    }
+
+    // Append the differences to the current iteration; the vectors of the
+    // oldest one are recycled if the history is full.
+    std::unique_ptr<GlobalVector> delta_g;
+    std::unique_ptr<GlobalVector> delta_dx;
+    if (static_cast<int>(_delta_g.size()) == _history_size)
+    {
+        delta_g = std::move(_delta_g.front());
+        delta_dx = std::move(_delta_dx.front());
+        _delta_g.pop_front();
+        _delta_dx.pop_front();
+        LinAlg::copy(x, *delta_g);
+        LinAlg::copy(dx, *delta_dx);
+    }
+    else
+    {
+        delta_g = VectorTraits::newInstance(x);
+        delta_dx = VectorTraits::newInstance(dx);
+    }
+    LinAlg::axpy(*delta_g, -1.0, *_g_previous);
+    LinAlg::axpy(*delta_dx, -1.0, *_dx_previous);
+    _delta_g.push_back(std::move(delta_g));
+    _delta_dx.push_back(std::move(delta_dx));
+
+    LinAlg::copy(x, *_g_previous);
+    LinAlg::copy(dx, *_dx_previous);
+
+    // Least-squares problem min |dx - Delta_dx gamma| via the normal
+    // equations, which are small; the sign of the residuals cancels.
+    auto const m = static_cast<Eigen::Index>(_delta_dx.size());
+    Eigen::MatrixXd A(m, m);
+    Eigen::VectorXd rhs(m);
+    for (Eigen::Index i = 0; i < m; ++i)
+    {
+        for (Eigen::Index j = 0; j <= i; ++j)
+        {
+            A(i, j) = LinAlg::dot(*_delta_dx[i], *_delta_dx[j]);
+            A(j, i) = A(i, j);
+        }
+        rhs[i] = LinAlg::dot(*_delta_dx[i], dx);
+    }
+    Eigen::VectorXd const gamma =
+        A.completeOrthogonalDecomposition().solve(rhs);
+
+    // x_{k+1} = G(x_k) - Delta_g gamma + (1 - beta) (dx - Delta_dx gamma)
+    LinAlg::axpy(x, 1.0 - _relaxation, dx);
+    for (Eigen::Index i = 0; i < m; ++i)
+    {
+        LinAlg::axpy(x, -gamma[i], *_delta_g[i]);
+        LinAlg::axpy(x, -(1.0 - _relaxation) * gamma[i], *_delta_dx[i]);
+    }
+}
+
+void accelerateUnlessConverged(
+    bool const converged,
+    std::vector<std::unique_ptr<FixedPointAcceleration>> const& accelerations,
+    std::vector<GlobalVector*> const& x,
+    std::vector<GlobalVector*> const& dx)
+{
+    if (converged)
+    {
+        return;
+    }
+    for (std::size_t i = 0; i < accelerations.size(); ++i)
+    {
+        accelerations[i]->accelerate(*x[i], *dx[i]);
+    }
+}
+
+std::vector<std::unique_ptr<FixedPointAcceleration>>
+createFixedPointAccelerations(BaseLib::ConfigTree const& config,
+                              std::size_t const number_of_vectors)
+{
+    //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__type}
+    auto const type = config.getConfigParameter<std::string>("type");
+
+    std::vector<std::unique_ptr<FixedPointAcceleration>> accelerations;
+    if (type == "Aitken")
+    {
+        auto const initial_relaxation =
+            //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__Aitken__initial_relaxation}
+            config.getConfigParameter<double>("initial_relaxation", 0.5);
+        if (initial_relaxation <= 0)
+        {
+            OGS_FATAL(
+                "The initial relaxation factor of the Aitken acceleration "
+                "must be positive, %g was given.",
+                initial_relaxation);
+        }
+        for (std::size_t i = 0; i < number_of_vectors; ++i)
+        {
+            accelerations.push_back(
+                std::make_unique<AitkenRelaxation>(initial_relaxation));
+        }
+        return accelerations;
+    }
+    if (type == "Anderson")
+    {
+        auto const history_size =
+            //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__Anderson__history_size}
+            config.getConfigParameter<int>("history_size", 5);
+        auto const relaxation =
+            //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__Anderson__relaxation}
+            config.getConfigParameter<double>("relaxation", 1.0);
+        for (std::size_t i = 0; i < number_of_vectors; ++i)
+        {
+            accelerations.push_back(std::make_unique<AndersonAcceleration>(
+                history_size, relaxation));
+        }
+        return accelerations;
+    }
+
+    OGS_FATAL("There is no fixed-point acceleration of type `%s'.",
+              type.c_str());
+}
+
+}  // namespace NumLib
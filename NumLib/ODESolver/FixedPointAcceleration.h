@@ -0,0 +1,131 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "NumLib/NumericsConfig.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+//! Accelerates the convergence of a fixed-point iteration
+//! \f$ x_{k+1} = G(x_k) \f$, e.g., of the coupling iterations of the staggered
+//! scheme.
+class FixedPointAcceleration
+{
+public:
+    //! Discards the history of previous iterations, e.g., at the beginning of
+    //! a new time step.
+    virtual void reset() = 0;
+
+    //! Computes the next iterate.
+    //!
+    //! \param x  on input the result \f$ G(x_k) \f$ of the current
+    //!           iteration, on output the accelerated iterate \f$ x_{k+1} \f$.
+    //! \param dx the negative fixed-point residual
+    //!           \f$ x_k - G(x_k) \f$, as used for the convergence check.
+    virtual void accelerate(GlobalVector& x, GlobalVector const& dx) = 0;
+
+    virtual ~FixedPointAcceleration() = default;
+};
+
+//! Aitken's \f$ \Delta^2 \f$ dynamic relaxation
+//! \f$ x_{k+1} = x_k + \omega_k r_k \f$ with the fixed-point residual
+//! \f$ r_k = G(x_k) - x_k \f$ and the relaxation factor
+//! \f[
+//!   \omega_k = -\omega_{k-1}
+//!     \frac{r_{k-1}^T (r_k - r_{k-1})}{\| r_k - r_{k-1} \|^2}.
+//! \f]
+class AitkenRelaxation final : public FixedPointAcceleration
+{
+public:
+    explicit AitkenRelaxation(double const initial_relaxation);
+
+    void reset() override;
+
+    void accelerate(GlobalVector& x, GlobalVector const& dx) override;
+
+private:
+    double const _initial_relaxation;
+    double _relaxation;
+
+    //! \c dx of the previous iteration or \c nullptr in the first iteration.
+    std::unique_ptr<GlobalVector> _dx_previous;
+    std::unique_ptr<GlobalVector> _ddx;  //!< temporary difference of \c dx.
+};
+
+//! Anderson acceleration, also known as interface quasi-Newton method with
+//! least-squares approximation of the inverse Jacobian (IQN-ILS).
+//!
+//! The new iterate is the combination of the last \c history_size + 1 iterates
+//! which minimizes the linearized fixed-point residual:
+//! \f[
+//!   \gamma = \arg\min \| r_k - \Delta R\, \gamma \|, \quad
+//!   x_{k+1} = G(x_k) - \Delta G\, \gamma
+//!             - (1 - \beta) (r_k - \Delta R\, \gamma),
+//! \f]
+//! where the columns of \f$ \Delta R \f$ and \f$ \Delta G \f$ are the
+//! differences of the residuals and of the results of \f$ G \f$ of consecutive
+//! iterations, and \f$ \beta \f$ is the relaxation factor.
+class AndersonAcceleration final : public FixedPointAcceleration
+{
+public:
+    AndersonAcceleration(int const history_size, double const relaxation);
+
+    void reset() override;
+
+    void accelerate(GlobalVector& x, GlobalVector const& dx) override;
+
+private:
+    int const _history_size;
+    double const _relaxation;
+
+    std::unique_ptr<GlobalVector> _g_previous;   //!< \f$ G(x_{k-1}) \f$.
+    std::unique_ptr<GlobalVector> _dx_previous;  //!< \f$ -r_{k-1} \f$.
+
+    //! Columns of \f$ \Delta G \f$, the newest at the back.
+    std::deque<std::unique_ptr<GlobalVector>> _delta_g;
+    //! Columns of \f$ -\Delta R \f$, the newest at the back.
+    std::deque<std::unique_ptr<GlobalVector>> _delta_dx;
+};
+
+//! Completes one iteration of the fixed-point iterations of several solution
+//! vectors, e.g., one sweep over the processes of the staggered scheme.
+//!
+//! If the iteration has converged, the results \c x of the last iteration are
+//! accepted as they are. Otherwise, each \c x[i] is accelerated with its
+//! negative fixed-point residual \c dx[i] by \c accelerations[i]. Nothing is
+//! done if \c accelerations is empty.
+void accelerateUnlessConverged(
+    bool const converged,
+    std::vector<std::unique_ptr<FixedPointAcceleration>> const& accelerations,
+    std::vector<GlobalVector*> const& x,
+    std::vector<GlobalVector*> const& dx);
+
+//! Creates one fixed-point acceleration of the configured type for each of
+//! the \c number_of_vectors solution vectors, which are accelerated
+//! independently.
+std::vector<std::unique_ptr<FixedPointAcceleration>>
+createFixedPointAccelerations(BaseLib::ConfigTree const& config,
+                              std::size_t const number_of_vectors);
+
+//! @}
+}  // namespace NumLib
@@ -0,0 +1,116 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "InexactNewtonForcingTerm.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+
+namespace NumLib
+{
+InexactNewtonForcingTerm::InexactNewtonForcingTerm(
+    double const initial_forcing_term, double const max_forcing_term,
+    double const gamma, double const alpha)
+    : _initial_forcing_term(initial_forcing_term),
+      _max_forcing_term(max_forcing_term),
+      _gamma(gamma),
+      _alpha(alpha),
+      _forcing_term(initial_forcing_term)
+{
+}
+
+void InexactNewtonForcingTerm::reset()
+{
+    _forcing_term = _initial_forcing_term;
+    _residual_norm = -1;
+}
+
+double InexactNewtonForcingTerm::next(double const residual_norm)
+{
+    if (_residual_norm > 0)
+    {
+        double const safeguard = _gamma * std::pow(_forcing_term, _alpha);
+        _forcing_term =
+            _gamma * std::pow(residual_norm / _residual_norm, _alpha);
+        // Avoids a too fast decrease of the forcing terms, if the residual
+        // dropped accidentally in one iteration.
+        if (safeguard > 0.1)
+        {
+            _forcing_term = std::max(_forcing_term, safeguard);
+        }
+        _forcing_term = std::min(_forcing_term, _max_forcing_term);
+    }
+    _residual_norm = residual_norm;
+    return _forcing_term;
+}
+
+std::unique_ptr<InexactNewtonForcingTerm> createInexactNewtonForcingTerm(
+    BaseLib::ConfigTree const& config)
+{
+    auto const inexact_newton_config =
+        //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__inexact_newton}
+        config.getConfigSubtreeOptional("inexact_newton");
+    if (!inexact_newton_config)
+    {
+        return nullptr;
+    }
+
+    auto const max_forcing_term =
+        //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__inexact_newton__max_forcing_term}
+        inexact_newton_config->getConfigParameter<double>("max_forcing_term",
+                                                          0.9);
+    auto const initial_forcing_term =
+        //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__inexact_newton__initial_forcing_term}
+        inexact_newton_config->getConfigParameter<double>(
+            "initial_forcing_term", 0.5);
+    //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__inexact_newton__gamma}
+    auto const gamma = inexact_newton_config->getConfigParameter<double>(
+        "gamma", 0.9);
+    //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__inexact_newton__alpha}
+    auto const alpha = inexact_newton_config->getConfigParameter<double>(
+        "alpha", 2.0);
+
+    if (!(max_forcing_term > 0 && max_forcing_term < 1))
+    {
+        OGS_FATAL(
+            "The maximum forcing term of the inexact Newton method must be in "
+            "(0, 1), got %g.",
+            max_forcing_term);
+    }
+    if (!(initial_forcing_term > 0 &&
+          initial_forcing_term <= max_forcing_term))
+    {
+        OGS_FATAL(
+            "The initial forcing term of the inexact Newton method must be in "
+            "(0, %g], got %g.",
+            max_forcing_term, initial_forcing_term);
+    }
+    if (!(gamma > 0 && gamma <= 1))
+    {
+        OGS_FATAL(
+            "The parameter gamma of the inexact Newton method must be in "
+            "(0, 1], got %g.",
+            gamma);
+    }
+    if (!(alpha > 1 && alpha <= 2))
+    {
+        OGS_FATAL(
+            "The parameter alpha of the inexact Newton method must be in "
+            "(1, 2], got %g.",
+            alpha);
+    }
+
+    return std::make_unique<InexactNewtonForcingTerm>(
+        initial_forcing_term, max_forcing_term, gamma, alpha);
+}
+}  // namespace NumLib
@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+//! Forcing terms \f$ \eta_k \f$ of an inexact Newton method, i.e., the
+//! relative tolerances \f$ \|J_k \Delta x_k + r_k\| \le \eta_k \|r_k\| \f$ of
+//! the linear solves, following choice 2 of Eisenstat and Walker (1996):
+//! \f[
+//!   \eta_k = \gamma \left( \frac{\|r_k\|}{\|r_{k-1}\|} \right)^\alpha,
+//! \f]
+//! safeguarded by \f$ \eta_k \ge \gamma \eta_{k-1}^\alpha \f$ if
+//! \f$ \gamma \eta_{k-1}^\alpha > 0.1 \f$ and limited to
+//! \f$ \eta_k \le \eta_{\max} \f$.
+//!
+//! In early iterations with a large residual the linear systems are solved
+//! loosely; the tolerance tightens as the Newton iteration converges.
+//!
+//! The Newton solver passes each forcing term to the linear solver's
+//! \c setForcingTerm(). The linear solvers use
+//! \f$ \max(\eta_k, \mathrm{tol}) \f$, where \f$ \mathrm{tol} \f$ is the
+//! configured relative tolerance, for all following solves until the next
+//! call, i.e., the forcing term never tightens the configured tolerance. A
+//! forcing term of zero restores the configured tolerance; it is set at the end
+//! of each Newton solve because the linear solver may be shared with other
+//! nonlinear solvers. Direct solvers ignore the forcing term.
+class InexactNewtonForcingTerm final
+{
+public:
+    InexactNewtonForcingTerm(double const initial_forcing_term,
+                             double const max_forcing_term, double const gamma,
+                             double const alpha);
+
+    //! Restarts the sequence, e.g., at the beginning of a time step.
+    void reset();
+
+    //! Returns the forcing term for the linear solve of the current
+    //! iteration.
+    //! \param residual_norm the norm of the current nonlinear residual.
+    double next(double const residual_norm);
+
+private:
+    double const _initial_forcing_term;
+    double const _max_forcing_term;
+    double const _gamma;
+    double const _alpha;
+
+    double _forcing_term;
+    //! Residual norm of the previous iteration; negative in the first one.
+    double _residual_norm = -1;
+};
+
+//! Creates the forcing terms from the optional \c inexact_newton subtree of
+//! the nonlinear solver configuration.
+std::unique_ptr<InexactNewtonForcingTerm> createInexactNewtonForcingTerm(
+    BaseLib::ConfigTree const& config);
+
+//! @}
+}  // namespace NumLib
@@ -14,6 +14,7 @@
 
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
+#include "BaseLib/EventTracer.h"
 #include "BaseLib/RunTime.h"
 #include "ConvergenceCriterion.h"
 #include "MathLib/LinAlg/LinAlg.h"
@@ -68,9 +69,17 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         &NumLib::GlobalVectorProvider::provider.getVector(_x_new_id);
     LinAlg::copy(*x[process_id], *x_new[process_id]);  // set initial guess
 
+    // The update is needed for the convergence check and the acceleration.
+    auto& minus_delta_x =
+        NumLib::GlobalVectorProvider::provider.getVector(_minus_delta_x_id);
+
     bool error_norms_met = false;
 
     _convergence_criterion->preFirstIteration();
+    if (_acceleration)
+    {
+        _acceleration->reset();
+    }
 
     int iteration = 1;
     for (; iteration <= _maxiter;
@@ -79,21 +88,30 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         BaseLib::RunTime timer_dirichlet;
         double time_dirichlet = 0.0;
 
+        BaseLib::TraceScope const trace_iteration("Picard iteration",
+                                                  "NumLib");
         BaseLib::RunTime time_iteration;
         time_iteration.start();
 
         timer_dirichlet.start();
-        sys.computeKnownSolutions(*x_new[process_id], process_id);
-        sys.applyKnownSolutions(*x_new[process_id]);
+        {
+            BaseLib::TraceScope const trace_dirichlet("Dirichlet BCs",
+                                                      "NumLib");
+            sys.computeKnownSolutions(*x_new[process_id], process_id);
+            sys.applyKnownSolutions(*x_new[process_id]);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
 
         sys.preIteration(iteration, *x_new[process_id]);
 
         BaseLib::RunTime time_assembly;
         time_assembly.start();
-        sys.assemble(x_new, process_id);
-        sys.getA(A);
-        sys.getRhs(rhs);
+        {
+            BaseLib::TraceScope const trace_assembly("assembly", "NumLib");
+            sys.assemble(x_new, process_id);
+            sys.getA(A);
+            sys.getRhs(rhs);
+        }
         INFO("[time] Assembly took %g s.", time_assembly.elapsed());
 
         // Subract non-equilibrium initial residuum if set
@@ -103,7 +121,11 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         }
 
         timer_dirichlet.start();
-        sys.applyKnownSolutionsPicard(A, rhs, *x_new[process_id]);
+        {
+            BaseLib::TraceScope const trace_dirichlet("Dirichlet BCs",
+                                                      "NumLib");
+            sys.applyKnownSolutionsPicard(A, rhs, *x_new[process_id]);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet);
 
@@ -116,8 +138,13 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
 
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded =
-            _linear_solver.solve(A, rhs, *x_new[process_id]);
+        bool iteration_succeeded = false;
+        {
+            BaseLib::TraceScope const trace_linear_solver("linear solver",
+                                                          "NumLib");
+            iteration_succeeded =
+                _linear_solver.solve(A, rhs, *x_new[process_id]);
+        }
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
 
         if (!iteration_succeeded)
@@ -167,15 +194,26 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         if (sys.isLinear()) {
             error_norms_met = true;
         } else {
-            if (_convergence_criterion->hasDeltaXCheck()) {
-                GlobalVector minus_delta_x(*x[process_id]);
+            if (_convergence_criterion->hasDeltaXCheck() || _acceleration)
+            {
+                LinAlg::copy(*x[process_id], minus_delta_x);
                 LinAlg::axpy(minus_delta_x, -1.0,
                              *x_new[process_id]);  // minus_delta_x = x - x_new
+            }
+
+            if (_convergence_criterion->hasDeltaXCheck()) {
                 _convergence_criterion->checkDeltaX(minus_delta_x,
                                                     *x_new[process_id]);
             }
 
             error_norms_met = _convergence_criterion->isSatisfied();
+
+            // The convergence is checked on the plain Picard update, the
+            // accelerated one is the starting point of the next iteration.
+            if (_acceleration && !error_norms_met)
+            {
+                _acceleration->accelerate(*x_new[process_id], minus_delta_x);
+            }
         }
 
         // Update x s.t. in the next iteration we will compute the right delta x
@@ -207,6 +245,7 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Picard>::solve(
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(A);
     NumLib::GlobalVectorProvider::provider.releaseVector(rhs);
     NumLib::GlobalVectorProvider::provider.releaseVector(*x_new[process_id]);
+    NumLib::GlobalVectorProvider::provider.releaseVector(minus_delta_x);
 
     return {error_norms_met, iteration};
 }
@@ -259,6 +298,11 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
 
     _convergence_criterion->preFirstIteration();
 
+    if (_forcing_term)
+    {
+        _forcing_term->reset();
+    }
+
     int iteration = 1;
     for (; iteration <= _maxiter;
          ++iteration, _convergence_criterion->reset())
@@ -266,12 +310,18 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
         BaseLib::RunTime timer_dirichlet;
         double time_dirichlet = 0.0;
 
+        BaseLib::TraceScope const trace_iteration("Newton iteration",
+                                                  "NumLib");
         BaseLib::RunTime time_iteration;
         time_iteration.start();
 
         timer_dirichlet.start();
-        sys.computeKnownSolutions(*x[process_id], process_id);
-        sys.applyKnownSolutions(*x[process_id]);
+        {
+            BaseLib::TraceScope const trace_dirichlet("Dirichlet BCs",
+                                                      "NumLib");
+            sys.computeKnownSolutions(*x[process_id], process_id);
+            sys.applyKnownSolutions(*x[process_id]);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
 
         sys.preIteration(iteration, *x[process_id]);
@@ -280,6 +330,7 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
         time_assembly.start();
         try
         {
+            BaseLib::TraceScope const trace_assembly("assembly", "NumLib");
             sys.assemble(x, process_id);
         }
         catch (AssemblyException const& e)
@@ -290,8 +341,12 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             iteration = _maxiter;
             break;
         }
-        sys.getResidual(*x[process_id], res);
-        sys.getJacobian(J);
+        {
+            BaseLib::TraceScope const trace_assembly("residual and Jacobian",
+                                                     "NumLib");
+            sys.getResidual(*x[process_id], res);
+            sys.getJacobian(J);
+        }
         INFO("[time] Assembly took %g s.", time_assembly.elapsed());
 
         // Subract non-equilibrium initial residuum if set
@@ -301,7 +356,11 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
         minus_delta_x.setZero();
 
         timer_dirichlet.start();
-        sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+        {
+            BaseLib::TraceScope const trace_dirichlet("Dirichlet BCs",
+                                                      "NumLib");
+            sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
+        }
         time_dirichlet += timer_dirichlet.elapsed();
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet);
 
@@ -310,9 +369,23 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             _convergence_criterion->checkResidual(res);
         }
 
+        if (_forcing_term)
+        {
+            double const forcing_term =
+                _forcing_term->next(LinAlg::norm2(res));
+            INFO("Newton: relative tolerance of the linear solver %g.",
+                 forcing_term);
+            _linear_solver.setForcingTerm(forcing_term);
+        }
+
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
+        bool iteration_succeeded = false;
+        {
+            BaseLib::TraceScope const trace_linear_solver("linear solver",
+                                                          "NumLib");
+            iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
+        }
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
 
         if (!iteration_succeeded)
@@ -405,6 +478,12 @@ NonlinearSolverStatus NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             _maxiter);
     }
 
+    if (_forcing_term)
+    {
+        // The linear solver might be shared with other nonlinear solvers.
+        _linear_solver.setForcingTerm(0);
+    }
+
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(J);
     NumLib::GlobalVectorProvider::provider.releaseVector(res);
     NumLib::GlobalVectorProvider::provider.releaseVector(
@@ -423,10 +502,24 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
     auto const max_iter = config.getConfigParameter<int>("max_iter");
 
     if (type == "Picard") {
+        std::unique_ptr<FixedPointAcceleration> acceleration;
+        if (auto const anderson_config =
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__anderson_acceleration}
+            config.getConfigSubtreeOptional("anderson_acceleration"))
+        {
+            acceleration = std::make_unique<AndersonAcceleration>(
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__anderson_acceleration__history_size}
+                anderson_config->getConfigParameter<int>("history_size", 5),
+                //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__anderson_acceleration__relaxation}
+                anderson_config->getConfigParameter<double>("relaxation", 1.0));
+        }
+
         auto const tag = NonlinearSolverTag::Picard;
         using ConcreteNLS = NonlinearSolver<tag>;
-        return std::make_pair(
-            std::make_unique<ConcreteNLS>(linear_solver, max_iter), tag);
+        return std::make_pair(std::make_unique<ConcreteNLS>(
+                                  linear_solver, max_iter,
+                                  std::move(acceleration)),
+                              tag);
     }
     if (type == "Newton")
     {
@@ -439,10 +532,12 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
                 "%g.",
                 damping);
         }
+        auto forcing_term = createInexactNewtonForcingTerm(config);
         auto const tag = NonlinearSolverTag::Newton;
         using ConcreteNLS = NonlinearSolver<tag>;
         return std::make_pair(
-            std::make_unique<ConcreteNLS>(linear_solver, max_iter, damping),
+            std::make_unique<ConcreteNLS>(linear_solver, max_iter, damping,
+                                          std::move(forcing_term)),
             tag);
     }
     OGS_FATAL("Unsupported nonlinear solver type");
@@ -15,6 +15,8 @@
 #include <logog/include/logog.hpp>
 
 #include "ConvergenceCriterion.h"
+#include "FixedPointAcceleration.h"
+#include "InexactNewtonForcingTerm.h"
 #include "NonlinearSolverStatus.h"
 #include "NonlinearSystem.h"
 #include "Types.h"
@@ -67,6 +69,9 @@ public:
             postIterationCallback,
         int const process_id) = 0;
 
+    //! The linear solver used by this nonlinear solver.
+    virtual GlobalLinearSolver& getLinearSolver() const = 0;
+
     virtual ~NonlinearSolverBase() = default;
 };
 
@@ -96,12 +101,21 @@ public:
      * \param maxiter the maximum number of iterations used to solve the
      *                equation.
      * \param damping A positive damping factor.
+     * \param forcing_term the forcing terms of an inexact Newton method, i.e.,
+     *                     the tolerances of the linear solves. If not given,
+     *                     the configured tolerance of the linear solver is
+     *                     used.
      * \see _damping
      */
-    explicit NonlinearSolver(GlobalLinearSolver& linear_solver,
-                             int const maxiter,
-                             double const damping = 1.0)
-        : _linear_solver(linear_solver), _maxiter(maxiter), _damping(damping)
+    explicit NonlinearSolver(
+        GlobalLinearSolver& linear_solver,
+        int const maxiter,
+        double const damping = 1.0,
+        std::unique_ptr<InexactNewtonForcingTerm>&& forcing_term = nullptr)
+        : _linear_solver(linear_solver),
+          _maxiter(maxiter),
+          _damping(damping),
+          _forcing_term(std::move(forcing_term))
     {
     }
 
@@ -125,6 +139,11 @@ public:
             postIterationCallback,
         int const process_id) override;
 
+    GlobalLinearSolver& getLinearSolver() const override
+    {
+        return _linear_solver;
+    }
+
     void compensateNonEquilibriumInitialResiduum(bool const value)
     {
         _compensate_non_equilibrium_initial_residuum = value;
@@ -144,6 +163,9 @@ private:
     //! conservative approach.
     double const _damping;
 
+    //! Forcing terms of the inexact Newton method or \c nullptr.
+    std::unique_ptr<InexactNewtonForcingTerm> _forcing_term;
+
     GlobalVector* _r_neq = nullptr;      //!< non-equilibrium initial residuum.
     std::size_t _res_id = 0u;            //!< ID of the residual vector.
     std::size_t _J_id = 0u;              //!< ID of the Jacobian matrix.
@@ -176,10 +198,15 @@ public:
      * \param linear_solver the linear solver used by this nonlinear solver.
      * \param maxiter the maximum number of iterations used to solve the
      *                equation.
+     * \param acceleration optional acceleration of the fixed-point
+     *                     iteration, e.g., Anderson mixing.
      */
-    explicit NonlinearSolver(GlobalLinearSolver& linear_solver,
-                             const int maxiter)
-        : _linear_solver(linear_solver), _maxiter(maxiter)
+    explicit NonlinearSolver(
+        GlobalLinearSolver& linear_solver, const int maxiter,
+        std::unique_ptr<FixedPointAcceleration>&& acceleration = nullptr)
+        : _linear_solver(linear_solver),
+          _maxiter(maxiter),
+          _acceleration(std::move(acceleration))
     {
     }
 
@@ -203,6 +230,11 @@ public:
             postIterationCallback,
         int const process_id) override;
 
+    GlobalLinearSolver& getLinearSolver() const override
+    {
+        return _linear_solver;
+    }
+
     void compensateNonEquilibriumInitialResiduum(bool const value)
     {
         _compensate_non_equilibrium_initial_residuum = value;
@@ -216,11 +248,16 @@ private:
     ConvergenceCriterion* _convergence_criterion = nullptr;
     const int _maxiter;  //!< maximum number of iterations
 
+    //! Acceleration of the Picard iterations or \c nullptr for plain
+    //! successive substitution.
+    std::unique_ptr<FixedPointAcceleration> _acceleration;
+
     GlobalVector* _r_neq = nullptr;  //!< non-equilibrium initial residuum.
     std::size_t _A_id = 0u;      //!< ID of the \f$ A \f$ matrix.
     std::size_t _rhs_id = 0u;    //!< ID of the right-hand side vector.
     std::size_t _x_new_id = 0u;  //!< ID of the vector storing the solution of
                                  //! the linearized equation.
+    std::size_t _minus_delta_x_id = 0u;  //!< ID of the \f$ -\Delta x\f$ vector.
 
     // clang-format off
     /// \copydoc NumLib::NonlinearSolver<NonlinearSolverTag::Newton>::_compensate_non_equilibrium_initial_residuum
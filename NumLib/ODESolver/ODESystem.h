@@ -65,6 +65,20 @@ public:
     {
         return nullptr;  // by default there are no known solutions
     }
+
+    //! Returns true if the mass matrix \c M of the given process depends
+    //! neither on time nor on the state. Then \c M is assembled only once and
+    //! reused in all subsequent iterations and time steps.
+    virtual bool isMassMatrixConstant(int const /*process_id*/) const
+    {
+        return false;
+    }
+
+    //! Enables or disables the assembly of \c M in assemble() and
+    //! assembleWithJacobian(). If disabled, \c M is left untouched.
+    //! Only called for systems with a constant mass matrix, cf.
+    //! isMassMatrixConstant().
+    virtual void setMassMatrixAssembly(bool const /*enabled*/) {}
 };
 
 /*! Interface for a first-order implicit quasi-linear ODE.
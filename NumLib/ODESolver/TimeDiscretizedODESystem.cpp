@@ -86,12 +86,23 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     auto& xdot = NumLib::GlobalVectorProvider::provider.getVector(_xdot_id);
     _time_disc.getXdot(*x_new_timestep[process_id], xdot);
 
-    _M->setZero();
+    // The Jacobian still contains the mass matrix contributions, only the
+    // global M is reused.
+    bool const reuse_M =
+        _is_M_assembled && _ode.isMassMatrixConstant(process_id);
+    if (!reuse_M)
+    {
+        _M->setZero();
+    }
     _K->setZero();
     _b->setZero();
     _Jac->setZero();
 
     _ode.preAssemble(t, dt, x_curr);
+    if (reuse_M)
+    {
+        _ode.setMassMatrixAssembly(false);
+    }
     try
     {
         _ode.assembleWithJacobian(t, dt, x_new_timestep, xdot, dxdot_dx, dx_dx,
@@ -99,11 +110,23 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     }
     catch (AssemblyException const&)
     {
+        if (reuse_M)
+        {
+            _ode.setMassMatrixAssembly(true);
+        }
         NumLib::GlobalVectorProvider::provider.releaseVector(xdot);
         throw;
     }
 
-    LinAlg::finalizeAssembly(*_M);
+    if (reuse_M)
+    {
+        _ode.setMassMatrixAssembly(true);
+    }
+    else
+    {
+        LinAlg::finalizeAssembly(*_M);
+        _is_M_assembled = true;
+    }
     LinAlg::finalizeAssembly(*_K);
     LinAlg::finalizeAssembly(*_b);
     MathLib::LinAlg::finalizeAssembly(*_Jac);
@@ -208,14 +231,28 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     auto const dt = _time_disc.getCurrentTimeIncrement();
     auto const& x_curr = _time_disc.getCurrentX(*x_new_timestep[process_id]);
 
-    _M->setZero();
+    bool const reuse_M =
+        _is_M_assembled && _ode.isMassMatrixConstant(process_id);
+    if (!reuse_M)
+    {
+        _M->setZero();
+    }
     _K->setZero();
     _b->setZero();
 
     _ode.preAssemble(t, dt, x_curr);
-    _ode.assemble(t, dt, x_new_timestep, process_id, *_M, *_K, *_b);
-
-    LinAlg::finalizeAssembly(*_M);
+    if (reuse_M)
+    {
+        _ode.setMassMatrixAssembly(false);
+        _ode.assemble(t, dt, x_new_timestep, process_id, *_M, *_K, *_b);
+        _ode.setMassMatrixAssembly(true);
+    }
+    else
+    {
+        _ode.assemble(t, dt, x_new_timestep, process_id, *_M, *_K, *_b);
+        LinAlg::finalizeAssembly(*_M);
+        _is_M_assembled = true;
+    }
     LinAlg::finalizeAssembly(*_K);
     LinAlg::finalizeAssembly(*_b);
 }
@@ -149,6 +149,10 @@ private:
 
     //! ID of the vector storing xdot in intermediate computations.
     mutable std::size_t _xdot_id = 0u;
+
+    //! Whether \c _M has been assembled already. A constant mass matrix is
+    //! not assembled again, cf. ODESystem::isMassMatrixConstant().
+    bool _is_M_assembled = false;
 };
 
 /*! Time discretized first order implicit quasi-linear ODE;
@@ -247,6 +251,10 @@ private:
     std::size_t _M_id = 0u;  //!< ID of the \c _M matrix.
     std::size_t _K_id = 0u;  //!< ID of the \c _K matrix.
     std::size_t _b_id = 0u;  //!< ID of the \c _b vector.
+
+    //! Whether \c _M has been assembled already. A constant mass matrix is
+    //! not assembled again, cf. ODESystem::isMassMatrixConstant().
+    bool _is_M_assembled = false;
 };
 
 //! @}
@@ -68,6 +68,24 @@ struct ConstantParameter final : public Parameter<T>
         return result;
     }
 
+    void getNodalValues(double const t,
+                        std::vector<std::size_t> const& node_ids,
+                        std::vector<T>& values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::getNodalValues(t, node_ids, values);
+            return;
+        }
+
+        values.resize(node_ids.size() * _values.size());
+        for (auto it = values.begin(); it != values.end();
+             it += _values.size())
+        {
+            std::copy(_values.begin(), _values.end(), it);
+        }
+    }
+
 private:
     std::vector<T> const _values;
 };
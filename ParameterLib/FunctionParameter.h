@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -78,6 +79,8 @@ struct FunctionParameter final : public Parameter<T>
                               SpatialPosition const& pos) const override
     {
         std::vector<T> cache(getNumberOfComponents());
+        // The variables of the symbol table are shared by all evaluations.
+        std::lock_guard<std::mutex> lock(_symbol_table_mutex);
         auto& x = _symbol_table.get_variable("x")->ref();
         auto& y = _symbol_table.get_variable("y")->ref();
         auto& z = _symbol_table.get_variable("z")->ref();
@@ -114,6 +117,7 @@ private:
     std::vector<std::string> const _vec_expression_str;
     symbol_table_t _symbol_table;
     std::vector<expression_t> _vec_expression;
+    mutable std::mutex _symbol_table_mutex;
 };
 
 std::unique_ptr<ParameterBase> createFunctionParameter(
@@ -88,6 +88,28 @@ struct MeshNodeParameter final : public Parameter<T>
         return result;
     }
 
+    void getNodalValues(double const t,
+                        std::vector<std::size_t> const& node_ids,
+                        std::vector<T>& values) const override
+    {
+        if (this->_coordinate_system)
+        {
+            Parameter<T>::getNodalValues(t, node_ids, values);
+            return;
+        }
+
+        auto const num_comp = _property.getNumberOfComponents();
+        values.resize(node_ids.size() * num_comp);
+        auto it = values.begin();
+        for (auto const node_id : node_ids)
+        {
+            for (int c = 0; c < num_comp; ++c)
+            {
+                *it++ = _property.getComponent(node_id, c);
+            }
+        }
+    }
+
 private:
     MeshLib::PropertyVector<T> const& _property;
 };
@@ -18,6 +18,7 @@
 #include "GroupBasedParameter.h"
 #include "MeshElementParameter.h"
 #include "MeshNodeParameter.h"
+#include "StreamedTimeSeriesParameter.h"
 #include "TimeDependentHeterogeneousParameter.h"
 
 namespace ParameterLib
@@ -76,6 +77,11 @@ std::unique_ptr<ParameterBase> createParameter(
         INFO("MeshNodeParameter: %s", name.c_str());
         return createMeshNodeParameter(name, config, mesh);
     }
+    if (type == "StreamedTimeSeries")
+    {
+        INFO("StreamedTimeSeriesParameter: %s", name.c_str());
+        return createStreamedTimeSeriesParameter(name, config, mesh);
+    }
     if (type == "TimeDependentHeterogeneousParameter")
     {
         INFO("TimeDependentHeterogeneousParameter: %s", name.c_str());
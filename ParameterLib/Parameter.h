@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <utility>
@@ -186,6 +187,30 @@ struct Parameter : public ParameterBase
 
         return result;
     }
+
+    //! Evaluates the parameter at all given nodes at once.
+    //
+    // The values are stored node by node, i.e. \c values has the size of
+    // the number of nodes times the number of components.
+    //
+    // The default implementation covers all cases, but the derived classes may
+    // provide faster implementations.
+    virtual void getNodalValues(double const t,
+                                std::vector<std::size_t> const& node_ids,
+                                std::vector<T>& values) const
+    {
+        auto const n_components = getNumberOfComponents();
+        values.resize(node_ids.size() * n_components);
+
+        SpatialPosition x_position;
+        auto it = values.begin();
+        for (auto const node_id : node_ids)
+        {
+            x_position.setNodeID(node_id);
+            auto const& node_values = this->operator()(t, x_position);
+            it = std::copy(node_values.begin(), node_values.end(), it);
+        }
+    }
 };
 
 //! Constructs a new ParameterBase from the given configuration.
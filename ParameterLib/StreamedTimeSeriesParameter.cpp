@@ -0,0 +1,343 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "StreamedTimeSeriesParameter.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <functional>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Mesh.h"
+
+namespace
+{
+constexpr std::array<char, 8> time_series_file_magic = {'O', 'G', 'S', 'T',
+                                                        'S', '0', '0', '1'};
+
+template <typename T>
+void readOrError(std::ifstream& in, T* data, std::size_t const size,
+                 std::string const& file_name)
+{
+    if (!in.read(reinterpret_cast<char*>(data), size * sizeof(T)))
+    {
+        OGS_FATAL("Could not read from the time series file `%s'.",
+                  file_name.c_str());
+    }
+}
+}  // namespace
+
+namespace ParameterLib
+{
+StreamedTimeSeriesParameter::StreamedTimeSeriesParameter(
+    std::string name, MeshLib::Mesh const& mesh, std::string file_name,
+    MeshLib::MeshItemType const item_type)
+    : Parameter<double>(std::move(name), &mesh),
+      _file_name(std::move(file_name)),
+      _item_type(item_type)
+{
+    std::ifstream in(_file_name, std::ios::binary);
+    if (!in)
+    {
+        OGS_FATAL("Could not open the time series file `%s'.",
+                  _file_name.c_str());
+    }
+
+    std::array<char, 8> magic{};
+    readOrError(in, magic.data(), magic.size(), _file_name);
+    if (magic != time_series_file_magic)
+    {
+        OGS_FATAL("The file `%s' is not an OGS time series file.",
+                  _file_name.c_str());
+    }
+
+    std::array<std::uint64_t, 3> sizes{};
+    readOrError(in, sizes.data(), sizes.size(), _file_name);
+    _number_of_items = sizes[0];
+    _number_of_components = sizes[1];
+    auto const number_of_times = sizes[2];
+
+    auto const number_of_mesh_items =
+        _item_type == MeshLib::MeshItemType::Node ? mesh.getNumberOfNodes()
+                                                  : mesh.getNumberOfElements();
+    if (_number_of_items != number_of_mesh_items)
+    {
+        OGS_FATAL(
+            "The time series file `%s' holds values for %lu mesh items, but "
+            "the mesh `%s' has %lu.",
+            _file_name.c_str(), static_cast<unsigned long>(_number_of_items),
+            mesh.getName().c_str(),
+            static_cast<unsigned long>(number_of_mesh_items));
+    }
+    if (_number_of_components == 0 || number_of_times == 0)
+    {
+        OGS_FATAL("The time series file `%s' holds no values.",
+                  _file_name.c_str());
+    }
+
+    _times.resize(number_of_times);
+    readOrError(in, _times.data(), _times.size(), _file_name);
+    if (std::adjacent_find(_times.begin(), _times.end(),
+                           std::greater_equal<>()) != _times.end())
+    {
+        OGS_FATAL(
+            "The times of the time series file `%s' aren't strictly "
+            "increasing.",
+            _file_name.c_str());
+    }
+    _data_offset =
+        magic.size() + sizeof(sizes) + sizeof(double) * _times.size();
+
+    in.seekg(0, std::ios::end);
+    auto const file_size = static_cast<std::uint64_t>(in.tellg());
+    if (file_size < _data_offset + sizeof(double) * _number_of_items *
+                                       _number_of_components * _times.size())
+    {
+        OGS_FATAL("The time series file `%s' is truncated.",
+                  _file_name.c_str());
+    }
+}
+
+std::vector<double> StreamedTimeSeriesParameter::operator()(
+    double const t, SpatialPosition const& pos) const
+{
+    auto const item_id = _item_type == MeshLib::MeshItemType::Node
+                             ? pos.getNodeID()
+                             : pos.getElementID();
+    if (!item_id)
+    {
+        OGS_FATAL(
+            "Trying to access the StreamedTimeSeriesParameter `%s' but the %s "
+            "id is not specified.",
+            name.c_str(),
+            _item_type == MeshLib::MeshItemType::Node ? "node" : "element");
+    }
+
+    auto const bracket = getBracket(t);
+    auto const& v0 = *bracket->slice0;
+    auto const& v1 = *bracket->slice1;
+    double const alpha =
+        bracket->index0 == bracket->index1
+            ? 0
+            : (t - _times[bracket->index0]) /
+                  (_times[bracket->index1] - _times[bracket->index0]);
+
+    std::vector<double> cache(_number_of_components);
+    auto const offset = *item_id * _number_of_components;
+    for (std::size_t c = 0; c < _number_of_components; ++c)
+    {
+        cache[c] = (1 - alpha) * v0[offset + c] + alpha * v1[offset + c];
+    }
+
+    if (!this->_coordinate_system)
+    {
+        return cache;
+    }
+
+    return this->rotateWithCoordinateSystem(cache, pos);
+}
+
+std::shared_ptr<StreamedTimeSeriesParameter::Bracket const>
+StreamedTimeSeriesParameter::getBracket(double const t) const
+{
+    auto const key = static_cast<std::size_t>(
+        std::upper_bound(_times.begin(), _times.end(), t) - _times.begin());
+
+    auto bracket = std::atomic_load(&_bracket);
+    if (bracket && bracket->key == key)
+    {
+        return bracket;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    // Another thread might have replaced the bracket in the meantime.
+    bracket = std::atomic_load(&_bracket);
+    if (bracket && bracket->key == key)
+    {
+        return bracket;
+    }
+
+    auto const number_of_times = _times.size();
+    auto const index0 = key == 0 ? 0 : key - 1;
+    auto const index1 = std::min(key, number_of_times - 1);
+
+    auto const getSlice = [&](std::size_t const index) {
+        if (bracket && bracket->index0 == index)
+        {
+            return bracket->slice0;
+        }
+        if (bracket && bracket->index1 == index)
+        {
+            return bracket->slice1;
+        }
+        if (_prefetched_slice.valid() && _prefetched_index == index)
+        {
+            return _prefetched_slice.get();
+        }
+        return readSlice(index);
+    };
+    auto const slice0 = getSlice(index0);
+    auto const slice1 = getSlice(index1);
+    auto new_bracket = std::make_shared<Bracket const>(
+        Bracket{key, index0, index1, slice0, slice1});
+    std::atomic_store(&_bracket, std::shared_ptr<Bracket const>(new_bracket));
+
+    // Time usually advances, hence the following slice is read in advance.
+    auto const next_index = index1 + 1;
+    if (next_index < number_of_times &&
+        !(_prefetched_slice.valid() && _prefetched_index == next_index))
+    {
+        _prefetched_index = next_index;
+        _prefetched_slice =
+            std::async(std::launch::async,
+                       [this, next_index]() { return readSlice(next_index); });
+    }
+
+    return new_bracket;
+}
+
+StreamedTimeSeriesParameter::Slice StreamedTimeSeriesParameter::readSlice(
+    std::size_t const index) const
+{
+    DBUG("Reading time slice %lu of the time series file `%s'.",
+         static_cast<unsigned long>(index), _file_name.c_str());
+
+    // Each read uses its own stream, such that reads in advance don't
+    // interfere with other reads.
+    std::ifstream in(_file_name, std::ios::binary);
+    if (!in)
+    {
+        OGS_FATAL("Could not open the time series file `%s'.",
+                  _file_name.c_str());
+    }
+    auto const slice_size = _number_of_items * _number_of_components;
+    in.seekg(_data_offset + sizeof(double) * slice_size * index);
+
+    auto slice = std::make_shared<std::vector<double>>(slice_size);
+    readOrError(in, slice->data(), slice->size(), _file_name);
+    return slice;
+}
+
+std::unique_ptr<ParameterBase> createStreamedTimeSeriesParameter(
+    std::string const& name, BaseLib::ConfigTree const& config,
+    MeshLib::Mesh const& mesh)
+{
+    //! \ogs_file_param{prj__parameters__parameter__type}
+    config.checkConfigParameter("type", "StreamedTimeSeries");
+    auto const file_name =
+        //! \ogs_file_param{prj__parameters__parameter__StreamedTimeSeries__file}
+        config.getConfigParameter<std::string>("file");
+    auto const mesh_item_type =
+        //! \ogs_file_param{prj__parameters__parameter__StreamedTimeSeries__mesh_item_type}
+        config.getConfigParameter<std::string>("mesh_item_type", "Node");
+
+    MeshLib::MeshItemType item_type;
+    if (mesh_item_type == "Node")
+    {
+        item_type = MeshLib::MeshItemType::Node;
+    }
+    else if (mesh_item_type == "Cell")
+    {
+        item_type = MeshLib::MeshItemType::Cell;
+    }
+    else
+    {
+        OGS_FATAL(
+            "The mesh item type `%s' of the parameter `%s' is not supported. "
+            "Use either `Node' or `Cell'.",
+            mesh_item_type.c_str(), name.c_str());
+    }
+
+    return std::make_unique<StreamedTimeSeriesParameter>(
+        name, mesh,
+        BaseLib::joinPaths(BaseLib::getProjectDirectory(), file_name),
+        item_type);
+}
+
+TimeSeriesFileWriter::TimeSeriesFileWriter(std::string file_name,
+                                           std::size_t const number_of_items,
+                                           int const number_of_components,
+                                           std::vector<double> const& times)
+    : _file_name(std::move(file_name)),
+      _slice_size(number_of_items * number_of_components),
+      _number_of_slices(times.size()),
+      _out(_file_name, std::ios::binary)
+{
+    if (!_out)
+    {
+        OGS_FATAL("Could not open the time series file `%s' for writing.",
+                  _file_name.c_str());
+    }
+    _out.write(time_series_file_magic.data(), time_series_file_magic.size());
+    std::array<std::uint64_t, 3> const sizes = {
+        {number_of_items, static_cast<std::uint64_t>(number_of_components),
+         times.size()}};
+    _out.write(reinterpret_cast<char const*>(sizes.data()), sizeof(sizes));
+    _out.write(reinterpret_cast<char const*>(times.data()),
+               sizeof(double) * times.size());
+}
+
+TimeSeriesFileWriter::~TimeSeriesFileWriter()
+{
+    if (_number_of_written_slices != _number_of_slices)
+    {
+        ERR("The time series file `%s' is incomplete. Only %lu of %lu time "
+            "slices have been written.",
+            _file_name.c_str(),
+            static_cast<unsigned long>(_number_of_written_slices),
+            static_cast<unsigned long>(_number_of_slices));
+    }
+}
+
+void TimeSeriesFileWriter::writeSlice(std::vector<double> const& slice)
+{
+    if (slice.size() != _slice_size)
+    {
+        OGS_FATAL("A time slice has the wrong number of values.");
+    }
+    if (_number_of_written_slices == _number_of_slices)
+    {
+        OGS_FATAL("All time slices of the time series file `%s' are written.",
+                  _file_name.c_str());
+    }
+    _out.write(reinterpret_cast<char const*>(slice.data()),
+               sizeof(double) * slice.size());
+    _out.flush();
+    if (!_out)
+    {
+        OGS_FATAL("Could not write the time series file `%s'.",
+                  _file_name.c_str());
+    }
+    ++_number_of_written_slices;
+}
+
+void writeTimeSeriesFile(std::string const& file_name,
+                         std::size_t const number_of_items,
+                         int const number_of_components,
+                         std::vector<double> const& times,
+                         std::vector<std::vector<double>> const& slices)
+{
+    if (times.size() != slices.size())
+    {
+        OGS_FATAL("The number of times and time slices differ.");
+    }
+
+    TimeSeriesFileWriter writer(file_name, number_of_items,
+                                number_of_components, times);
+    for (auto const& slice : slices)
+    {
+        writer.writeSlice(slice);
+    }
+}
+
+}  // namespace ParameterLib
@@ -0,0 +1,143 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "MeshLib/Location.h"
+#include "Parameter.h"
+
+namespace ParameterLib
+{
+/// A parameter varying in time and space, whose values at the mesh nodes or
+/// elements are read on demand from a binary time series file.
+///
+/// Only the two time slices bracketing the requested time are held in memory.
+/// The slice following them is read asynchronously in advance. Between two
+/// slices the values are interpolated linearly in time, before the first and
+/// after the last slice they are constant.
+///
+/// The parameter is not aware of MPI partitions. Each process searches the
+/// bracket and reads the complete slices on its own, and the values are
+/// indexed by the node or element ids of the mesh the parameter is defined
+/// on. For a partitioned mesh these are the local ids of the partition.
+///
+/// The file consists of (native byte order)
+/// - the 8 characters \c OGSTS001,
+/// - the number of mesh items, the number of components and the number of
+///   time slices as 64 bit unsigned integers,
+/// - the strictly increasing times of the slices as doubles,
+/// - the slices one after another, each holding all components of the first
+///   mesh item, then all components of the second item and so on, as doubles.
+class StreamedTimeSeriesParameter final : public Parameter<double>
+{
+public:
+    StreamedTimeSeriesParameter(std::string name, MeshLib::Mesh const& mesh,
+                                std::string file_name,
+                                MeshLib::MeshItemType const item_type);
+
+    bool isTimeDependent() const override { return true; }
+
+    /// @copydoc Parameter::getNumberOfComponents()
+    int getNumberOfComponents() const override
+    {
+        return static_cast<int>(_number_of_components);
+    }
+
+    /// @copydoc Parameter::operator()()
+    std::vector<double> operator()(double const t,
+                                   SpatialPosition const& pos) const override;
+
+private:
+    using Slice = std::shared_ptr<std::vector<double> const>;
+
+    /// The slices around a point in time. Both slices are the same before the
+    /// first and after the last time of the series.
+    struct Bracket
+    {
+        /// Number of times of the series less or equal the bracketed times.
+        std::size_t key;
+        std::size_t index0;
+        std::size_t index1;
+        Slice slice0;
+        Slice slice1;
+    };
+
+    std::shared_ptr<Bracket const> getBracket(double const t) const;
+    Slice readSlice(std::size_t const index) const;
+
+    std::string const _file_name;
+    MeshLib::MeshItemType const _item_type;
+    std::uint64_t _number_of_items = 0;
+    std::uint64_t _number_of_components = 0;
+    std::vector<double> _times;
+    /// Offset of the first slice in the file.
+    std::uint64_t _data_offset = 0;
+
+    /// The current bracket is replaced by std::atomic_store, such that
+    /// evaluations running concurrently keep their slices alive. The atomic
+    /// shared_ptr functions are not lock-free in general; libstdc++ implements
+    /// them with a pool of mutexes.
+    mutable std::shared_ptr<Bracket const> _bracket;
+    /// Serializes reading and replacing the bracket.
+    mutable std::mutex _mutex;
+    /// The slice read in advance and its index. Declared last, such that a
+    /// pending read finishes before the other members are destroyed.
+    mutable std::future<Slice> _prefetched_slice;
+    mutable std::size_t _prefetched_index = 0;
+};
+
+std::unique_ptr<ParameterBase> createStreamedTimeSeriesParameter(
+    std::string const& name, BaseLib::ConfigTree const& config,
+    MeshLib::Mesh const& mesh);
+
+/// Writes a file readable by the StreamedTimeSeriesParameter slice by slice,
+/// such that the whole time series needs not to be held in memory.
+class TimeSeriesFileWriter final
+{
+public:
+    /// Writes the header of the file. Exactly one slice has to be written for
+    /// each of the \c times afterwards.
+    TimeSeriesFileWriter(std::string file_name,
+                         std::size_t const number_of_items,
+                         int const number_of_components,
+                         std::vector<double> const& times);
+
+    /// Checks that all slices have been written.
+    ~TimeSeriesFileWriter();
+
+    /// Appends the next slice holding \c number_of_items times
+    /// \c number_of_components values.
+    void writeSlice(std::vector<double> const& slice);
+
+private:
+    std::string const _file_name;
+    std::size_t const _slice_size;
+    std::size_t const _number_of_slices;
+    std::size_t _number_of_written_slices = 0;
+    std::ofstream _out;
+};
+
+/// Writes a file readable by the StreamedTimeSeriesParameter. Each of the
+/// \c slices holds \c number_of_items times \c number_of_components values.
+void writeTimeSeriesFile(std::string const& file_name,
+                         std::size_t const number_of_items,
+                         int const number_of_components,
+                         std::vector<double> const& times,
+                         std::vector<std::vector<double>> const& slices);
+
+}  // namespace ParameterLib
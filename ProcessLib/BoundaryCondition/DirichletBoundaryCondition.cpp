@@ -44,15 +44,17 @@ DirichletBoundaryCondition::DirichletBoundaryCondition(
     // and component id.
     _dof_table_boundary.reset(dof_table_bulk.deriveBoundaryConstrainedMap(
         variable_id, {component_id}, std::move(bc_mesh_subset)));
+
+    _bc_values_cache = std::make_unique<EssentialBCValuesCache>(
+        _bc_mesh, _bc_mesh.getNodes(), *_dof_table_boundary, _variable_id,
+        _component_id);
 }
 
 void DirichletBoundaryCondition::getEssentialBCValues(
-    const double t, GlobalVector const& x,
+    const double t, GlobalVector const& /*x*/,
     NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
 {
-    getEssentialBCValuesLocal(_parameter, _bc_mesh, _bc_mesh.getNodes(),
-                              *_dof_table_boundary, _variable_id, _component_id,
-                              t, x, bc_values);
+    _bc_values_cache->getEssentialBCValues(_parameter, t, bc_values);
 }
 
 std::unique_ptr<DirichletBoundaryCondition> createDirichletBoundaryCondition(
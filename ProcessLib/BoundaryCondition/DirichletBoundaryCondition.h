@@ -11,6 +11,7 @@
 #pragma once
 
 #include "BoundaryCondition.h"
+#include "DirichletBoundaryConditionAuxiliaryFunctions.h"
 
 namespace BaseLib
 {
@@ -49,6 +50,8 @@ private:
     std::unique_ptr<NumLib::LocalToGlobalIndexMap const> _dof_table_boundary;
     int const _variable_id;
     int const _component_id;
+
+    std::unique_ptr<EssentialBCValuesCache> _bc_values_cache;
 };
 
 std::unique_ptr<DirichletBoundaryCondition> createDirichletBoundaryCondition(
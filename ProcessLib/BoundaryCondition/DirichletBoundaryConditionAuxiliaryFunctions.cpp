@@ -55,28 +55,18 @@ void checkParametersOfDirichletBoundaryCondition(
         bc_mesh.getNodes().size(), variable_id, component_id);
 }
 
-void getEssentialBCValuesLocal(
-    ParameterLib::Parameter<double> const& parameter,
+EssentialBCValuesCache::EssentialBCValuesCache(
     MeshLib::Mesh const& bc_mesh,
     std::vector<MeshLib::Node*> const& nodes_in_bc_mesh,
     NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
-    int const variable_id, int const component_id, const double t,
-    GlobalVector const& /*x*/,
-    NumLib::IndexValueVector<GlobalIndexType>& bc_values)
+    int const variable_id, int const component_id)
 {
-    ParameterLib::SpatialPosition pos;
-
-    bc_values.ids.clear();
-    bc_values.values.clear();
-
     // convert mesh node ids to global index for the given component
-    bc_values.ids.reserve(bc_values.ids.size() + nodes_in_bc_mesh.size());
-    bc_values.values.reserve(bc_values.values.size() + nodes_in_bc_mesh.size());
+    _node_ids.reserve(nodes_in_bc_mesh.size());
+    _global_indices.reserve(nodes_in_bc_mesh.size());
     for (auto const* const node : nodes_in_bc_mesh)
     {
         auto const id = node->getID();
-        pos.setNodeID(node->getID());
-        // TODO: that might be slow, but only done once
         auto const global_index = dof_table_boundary.getGlobalIndex(
             {bc_mesh.getID(), MeshLib::MeshItemType::Node, id}, variable_id,
             component_id);
@@ -93,9 +83,24 @@ void getEssentialBCValuesLocal(
         // applied.
         if (global_index >= 0)
         {
-            bc_values.ids.emplace_back(global_index);
-            bc_values.values.emplace_back(parameter(t, pos).front());
+            _node_ids.push_back(id);
+            _global_indices.push_back(global_index);
         }
     }
 }
+
+void EssentialBCValuesCache::getEssentialBCValues(
+    ParameterLib::Parameter<double> const& parameter, double const t,
+    NumLib::IndexValueVector<GlobalIndexType>& bc_values)
+{
+    if (!_values_are_valid || (parameter.isTimeDependent() && t != _t))
+    {
+        parameter.getNodalValues(t, _node_ids, _values);
+        _t = t;
+        _values_are_valid = true;
+    }
+
+    bc_values.ids = _global_indices;
+    bc_values.values = _values;
+}
 }  // namespace ProcessLib
@@ -47,12 +47,36 @@ void checkParametersOfDirichletBoundaryCondition(
     int const variable_id,
     int const component_id);
 
-void getEssentialBCValuesLocal(
-    ParameterLib::Parameter<double> const& parameter,
-    MeshLib::Mesh const& bc_mesh,
-    std::vector<MeshLib::Node*> const& nodes_in_bc_mesh,
-    NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
-    int const variable_id, int const component_id, const double t,
-    GlobalVector const& x,
-    NumLib::IndexValueVector<GlobalIndexType>& bc_values);
+/// Global indices and values of the essential boundary conditions of one
+/// Dirichlet-type boundary condition.
+///
+/// The global indices of the boundary nodes do not change during the
+/// simulation and are determined once at construction. The boundary values
+/// are evaluated for all nodes at once and only re-evaluated if the parameter
+/// is time dependent and the time has changed since the last evaluation.
+class EssentialBCValuesCache final
+{
+public:
+    EssentialBCValuesCache(
+        MeshLib::Mesh const& bc_mesh,
+        std::vector<MeshLib::Node*> const& nodes_in_bc_mesh,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
+        int const variable_id, int const component_id);
+
+    void getEssentialBCValues(
+        ParameterLib::Parameter<double> const& parameter, double const t,
+        NumLib::IndexValueVector<GlobalIndexType>& bc_values);
+
+private:
+    /// Ids of the nodes in the boundary mesh having a non-ghost global index.
+    std::vector<std::size_t> _node_ids;
+    /// Global indices corresponding to the \c _node_ids.
+    std::vector<GlobalIndexType> _global_indices;
+
+    /// Parameter values at the \c _node_ids from the last evaluation.
+    std::vector<double> _values;
+    /// Time of the last evaluation of the parameter values.
+    double _t = 0;
+    bool _values_are_valid = false;
+};
 }  // namespace ProcessLib
@@ -74,17 +74,19 @@ void DirichletBoundaryConditionWithinTimeInterval::config(
     // and component id.
     _dof_table_boundary.reset(dof_table_bulk.deriveBoundaryConstrainedMap(
         _variable_id, {_component_id}, std::move(bc_mesh_subset)));
+
+    _bc_values_cache = std::make_unique<EssentialBCValuesCache>(
+        _bc_mesh, _nodes_in_bc_mesh, *_dof_table_boundary, _variable_id,
+        _component_id);
 }
 
 void DirichletBoundaryConditionWithinTimeInterval::getEssentialBCValues(
-    const double t, GlobalVector const& x,
+    const double t, GlobalVector const& /*x*/,
     NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
 {
     if (_time_interval->contains(t))
     {
-        getEssentialBCValuesLocal(_parameter, _bc_mesh, _nodes_in_bc_mesh,
-                                  *_dof_table_boundary, _variable_id,
-                                  _component_id, t, x, bc_values);
+        _bc_values_cache->getEssentialBCValues(_parameter, t, bc_values);
         return;
     }
 
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "BoundaryCondition.h"
+#include "DirichletBoundaryConditionAuxiliaryFunctions.h"
 
 namespace BaseLib
 {
@@ -70,6 +71,8 @@ private:
     int const _variable_id;
     int const _component_id;
 
+    std::unique_ptr<EssentialBCValuesCache> _bc_values_cache;
+
     std::unique_ptr<BaseLib::TimeInterval const> _time_interval;
 
     void config(NumLib::LocalToGlobalIndexMap const& dof_table_bulk);
@@ -9,6 +9,7 @@
  */
 
 #include "GenericNaturalBoundaryConditionLocalAssembler.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
 namespace ProcessLib
@@ -81,7 +82,7 @@ void GenericNaturalBoundaryCondition<BoundaryConditionData,
                    GlobalVector& b,
                    GlobalMatrix* Jac)
 {
-    GlobalExecutor::executeMemberOnDereferenced(
+    NumLib::ParallelExecutor::executeMemberOnDereferenced(
         &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
         _local_assemblers, *_dof_table_boundary, t, x, process_id, K, b, Jac);
 }
@@ -13,6 +13,7 @@
 #include "GenericNaturalBoundaryConditionLocalAssembler.h"
 #include "MeshLib/Elements/MapBulkElementPoint.h"
 #include "MeshLib/PropertyVector.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Function/Interpolation.h"
 #include "ParameterLib/MeshNodeParameter.h"
@@ -109,7 +110,9 @@ public:
             _local_rhs.noalias() += N * neumann_node_values.dot(N) * w;
         }
 
-        b.add(indices, _local_rhs);
+        NumLib::ParallelExecutor::executeExclusively([&]() {
+            b.add(indices, _local_rhs);
+        });
     }
 
 private:
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "GenericNaturalBoundaryConditionLocalAssembler.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "ParameterLib/Parameter.h"
@@ -88,7 +89,9 @@ public:
         }
 
         auto const indices = NumLib::getIndices(id, dof_table_boundary);
-        b.add(indices, _local_rhs);
+        NumLib::ParallelExecutor::executeExclusively([&]() {
+            b.add(indices, _local_rhs);
+        });
     }
 
 private:
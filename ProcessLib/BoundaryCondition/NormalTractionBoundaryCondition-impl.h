@@ -14,6 +14,7 @@
 
 #include "MeshLib/MeshSearch/NodeSearch.h"
 #include "ParameterLib/Utils.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
 #include "NormalTractionBoundaryConditionLocalAssembler.h"
@@ -66,7 +67,7 @@ void NormalTractionBoundaryCondition<LocalAssemblerImplementation>::
                    int const /*process_id*/, GlobalMatrix& K, GlobalVector& b,
                    GlobalMatrix* Jac)
 {
-    GlobalExecutor::executeMemberOnDereferenced(
+    NumLib::ParallelExecutor::executeMemberOnDereferenced(
         &NormalTractionBoundaryConditionLocalAssemblerInterface::assemble,
         _local_assemblers, *_dof_table_boundary, t, x, K, b, Jac);
 }
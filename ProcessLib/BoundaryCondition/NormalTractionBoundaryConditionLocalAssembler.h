@@ -12,6 +12,7 @@
 
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "MeshLib/Elements/FaceRule.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "ParameterLib/Parameter.h"
 
@@ -149,7 +150,9 @@ public:
         }
 
         auto const indices = NumLib::getIndices(id, dof_table_boundary);
-        local_rhs.add(indices, _local_rhs);
+        NumLib::ParallelExecutor::executeExclusively([&]() {
+            local_rhs.add(indices, _local_rhs);
+        });
     }
 
 private:
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "GenericNaturalBoundaryConditionLocalAssembler.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "ParameterLib/Parameter.h"
 
@@ -91,9 +92,12 @@ public:
         }
 
         auto const indices = NumLib::getIndices(id, dof_table_boundary);
-        K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices),
-              _local_K);
-        b.add(indices, _local_rhs);
+        NumLib::ParallelExecutor::executeExclusively([&]() {
+            K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices,
+                                                                  indices),
+                  _local_K);
+            b.add(indices, _local_rhs);
+        });
     }
 
 private:
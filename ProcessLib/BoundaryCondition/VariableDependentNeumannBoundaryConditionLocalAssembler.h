@@ -11,6 +11,7 @@
 #pragma once
 
 #include "MeshLib/PropertyVector.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Function/Interpolation.h"
 #include "ParameterLib/MeshNodeParameter.h"
@@ -115,7 +116,9 @@ public:
             _local_rhs.noalias() += N * neumann_node_values.dot(N) * w;
         }
 
-        b.add(indices_current_variable, _local_rhs);
+        NumLib::ParallelExecutor::executeExclusively([&]() {
+            b.add(indices_current_variable, _local_rhs);
+        });
     }
 
 private:
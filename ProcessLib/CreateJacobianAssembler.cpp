@@ -14,6 +14,7 @@
 #include "AnalyticalJacobianAssembler.h"
 #include "CentralDifferencesJacobianAssembler.h"
 #include "CompareJacobiansJacobianAssembler.h"
+#include "ForwardADJacobianAssembler.h"
 
 namespace ProcessLib
 {
@@ -40,6 +41,11 @@ std::unique_ptr<AbstractJacobianAssembler> createJacobianAssembler(
     {
         return createCompareJacobiansJacobianAssembler(*config);
     }
+    if (type == "ForwardAD")
+    {
+        config->ignoreConfigParameter("type");
+        return std::make_unique<ForwardADJacobianAssembler>();
+    }
 
     OGS_FATAL("Unknown Jacobian assembler type: `%s'.", type.c_str());
 }
@@ -97,6 +97,14 @@ std::vector<std::unique_ptr<ProcessData>> createPerProcessData(
             pcs_config.getConfigParameter<bool>(
                 "compensate_non_equilibrium_initial_residuum", false);
 
+        if (
+            //! \ogs_file_param{prj__time_loop__processes__process__compute_secondary_variables_each_timestep}
+            pcs_config.getConfigParameter<bool>(
+                "compute_secondary_variables_each_timestep", false))
+        {
+            pcs.requireSecondaryVariablesEachTimestep();
+        }
+
         //! \ogs_file_param{prj__time_loop__processes__process__output}
         auto output = pcs_config.getConfigSubtreeOptional("output");
         if (output)
@@ -11,6 +11,7 @@
 #include "CreateTimeLoop.h"
 
 #include "BaseLib/ConfigTree.h"
+#include "NumLib/ODESolver/FixedPointAcceleration.h"
 #include "ProcessLib/CreateProcessData.h"
 #include "ProcessLib/Output/CreateOutput.h"
 #include "ProcessLib/Output/Output.h"
@@ -65,6 +66,8 @@ std::unique_ptr<TimeLoop> createTimeLoop(
         //! \ogs_file_param{prj__time_loop__processes}
         config.getConfigSubtree("processes"), processes, nonlinear_solvers);
 
+    std::vector<std::unique_ptr<NumLib::FixedPointAcceleration>>
+        global_coupling_accelerations;
     if (coupling_config)
     {
         if (global_coupling_conv_criteria.size() != per_process_data.size())
@@ -75,6 +78,15 @@ std::unique_ptr<TimeLoop> createTimeLoop(
                 "processes! Please check the element by tag "
                 "global_process_coupling in the project file.");
         }
+
+        if (auto const acceleration_config =
+                //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration}
+            coupling_config->getConfigSubtreeOptional("acceleration"))
+        {
+            global_coupling_accelerations =
+                NumLib::createFixedPointAccelerations(*acceleration_config,
+                                                      per_process_data.size());
+        }
     }
 
     const auto minmax_iter = std::minmax_element(
@@ -93,7 +105,8 @@ std::unique_ptr<TimeLoop> createTimeLoop(
 
     return std::make_unique<TimeLoop>(
         std::move(output), std::move(per_process_data), max_coupling_iterations,
-        std::move(global_coupling_conv_criteria), std::move(phreeqc_io),
+        std::move(global_coupling_conv_criteria),
+        std::move(global_coupling_accelerations), std::move(phreeqc_io),
         start_time, end_time);
 }
 }  // namespace ProcessLib
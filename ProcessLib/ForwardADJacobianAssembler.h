@@ -0,0 +1,99 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+
+#include "AbstractJacobianAssembler.h"
+#include "MathLib/DualNumber.h"
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+
+namespace ProcessLib
+{
+//! Assembles the Jacobian matrix exactly by forward mode automatic
+//! differentiation of the local residual.
+//!
+//! The local assembler has to implement
+//! LocalAssemblerInterface::assembleWithJacobianForwardAD(), usually by
+//! forwarding its residual to assembleResidualWithDualNumbers().
+class ForwardADJacobianAssembler final : public AbstractJacobianAssembler
+{
+public:
+    //! Assembles the Jacobian, the matrices \f$M\f$ and \f$K\f$, and the vector
+    //! \f$b\f$.
+    //! In this implementation the call is only forwarded to the respective
+    //! method of the given \c local_assembler.
+    void assembleWithJacobian(LocalAssemblerInterface& local_assembler,
+                              double const t, double const dt,
+                              std::vector<double> const& local_x,
+                              std::vector<double> const& local_xdot,
+                              const double dxdot_dx, const double dx_dx,
+                              std::vector<double>& local_M_data,
+                              std::vector<double>& local_K_data,
+                              std::vector<double>& local_b_data,
+                              std::vector<double>& local_Jac_data) override;
+};
+
+//! Evaluates the local residual \f$ r(x, \dot x) = M \dot x + K x - b \f$ once
+//! with dual numbers carrying \c N derivatives and stores \f$ -r \f$ in
+//! \c local_b_data and the exact Jacobian
+//! \f[
+//!   J = \frac{\partial r}{\partial x} \frac{\partial x}{\partial x}
+//!     + \frac{\partial r}{\partial \dot x} \frac{\partial \dot x}{\partial x}
+//! \f]
+//! in \c local_Jac_data.
+//!
+//! \tparam N the number of local degrees of freedom, which has to be known at
+//! compile time, e.g., <tt>ShapeFunction::NPOINTS * NumberOfComponents</tt>.
+//! \param residual callable with the signature
+//! <tt>void(Vector const& x, Vector const& x_dot, Vector& r)</tt>, where
+//! <tt>Vector = Eigen::Matrix<MathLib::DualNumber<N>, N, 1></tt>; usually a
+//! generic lambda such that the same code can be evaluated with doubles.
+//! \c r is zero initialized.
+template <int N, typename Residual>
+void assembleResidualWithDualNumbers(Residual&& residual,
+                                     std::vector<double> const& local_x,
+                                     std::vector<double> const& local_xdot,
+                                     const double dxdot_dx, const double dx_dx,
+                                     std::vector<double>& local_b_data,
+                                     std::vector<double>& local_Jac_data)
+{
+    using Dual = MathLib::DualNumber<N>;
+    using DualVector = Eigen::Matrix<Dual, N, 1>;
+
+    assert(local_x.size() == static_cast<std::size_t>(N));
+    assert(local_xdot.size() == static_cast<std::size_t>(N));
+
+    // Seeding with dx/dx and dxdot/dx yields the total derivative w.r.t. x in
+    // one evaluation.
+    DualVector x;
+    DualVector x_dot;
+    for (int i = 0; i < N; ++i)
+    {
+        x[i] = Dual::variable(local_x[i], i, dx_dx);
+        x_dot[i] = Dual::variable(local_xdot[i], i, dxdot_dx);
+    }
+
+    DualVector r = DualVector::Constant(Dual{0.0});
+    residual(x, x_dot, r);
+
+    auto local_b = MathLib::createZeroedVector<Eigen::Matrix<double, N, 1>>(
+        local_b_data, N);
+    auto local_Jac = MathLib::createZeroedMatrix<
+        Eigen::Matrix<double, N, N, Eigen::RowMajor>>(local_Jac_data, N, N);
+    for (int i = 0; i < N; ++i)
+    {
+        local_b[i] = -r[i].value();
+        local_Jac.row(i) = r[i].derivatives().transpose();
+    }
+}
+
+}  // namespace ProcessLib
@@ -0,0 +1,76 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include "MaterialLib/MPL/Medium.h"
+#include "MaterialLib/MPL/Property.h"
+
+namespace ProcessLib
+{
+namespace HT
+{
+/// The medium, phases, and properties used by the HT local assemblers of one
+/// element.
+///
+/// They are resolved once when the local assembler is constructed, which
+/// removes the lookups of the medium by element id and of the phases by name
+/// from the integration point loops. The existence of the properties is
+/// verified by checkMPLProperties() before the local assemblers are created.
+struct HTElementMaterial final
+{
+    explicit HTElementMaterial(MaterialPropertyLib::Medium const& medium_)
+        : medium(medium_),
+          liquid_phase(medium.phase("AqueousLiquid")),
+          solid_phase(medium.phase("Solid")),
+          porosity(medium.property(MaterialPropertyLib::porosity)),
+          permeability(medium.property(MaterialPropertyLib::permeability)),
+          thermal_longitudinal_dispersivity(medium.property(
+              MaterialPropertyLib::thermal_longitudinal_dispersivity)),
+          thermal_transversal_dispersivity(medium.property(
+              MaterialPropertyLib::thermal_transversal_dispersivity)),
+          liquid_density(liquid_phase.property(MaterialPropertyLib::density)),
+          liquid_viscosity(
+              liquid_phase.property(MaterialPropertyLib::viscosity)),
+          liquid_specific_heat_capacity(liquid_phase.property(
+              MaterialPropertyLib::specific_heat_capacity)),
+          liquid_thermal_conductivity(
+              liquid_phase.property(MaterialPropertyLib::thermal_conductivity)),
+          solid_density(solid_phase.property(MaterialPropertyLib::density)),
+          solid_storage(solid_phase.property(MaterialPropertyLib::storage)),
+          solid_specific_heat_capacity(solid_phase.property(
+              MaterialPropertyLib::specific_heat_capacity)),
+          solid_thermal_conductivity(
+              solid_phase.property(MaterialPropertyLib::thermal_conductivity))
+    {
+    }
+
+    MaterialPropertyLib::Medium const& medium;
+    MaterialPropertyLib::Phase const& liquid_phase;
+    MaterialPropertyLib::Phase const& solid_phase;
+
+    MaterialPropertyLib::Property const& porosity;
+    MaterialPropertyLib::Property const& permeability;
+    MaterialPropertyLib::Property const& thermal_longitudinal_dispersivity;
+    MaterialPropertyLib::Property const& thermal_transversal_dispersivity;
+
+    MaterialPropertyLib::Property const& liquid_density;
+    MaterialPropertyLib::Property const& liquid_viscosity;
+    MaterialPropertyLib::Property const& liquid_specific_heat_capacity;
+    MaterialPropertyLib::Property const& liquid_thermal_conductivity;
+
+    MaterialPropertyLib::Property const& solid_density;
+    MaterialPropertyLib::Property const& solid_storage;
+    MaterialPropertyLib::Property const& solid_specific_heat_capacity;
+    MaterialPropertyLib::Property const& solid_thermal_conductivity;
+};
+
+}  // namespace HT
+}  // namespace ProcessLib
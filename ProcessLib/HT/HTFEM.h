@@ -13,6 +13,7 @@
 #include <Eigen/Dense>
 #include <vector>
 
+#include "HTElementMaterial.h"
 #include "HTProcessData.h"
 
 #include "MaterialLib/MPL/Medium.h"
@@ -56,6 +57,7 @@ public:
         : HTLocalAssemblerInterface(),
           _element(element),
           _process_data(process_data),
+          _material(*process_data.media_map->getMedium(element.getID())),
           _integration_method(integration_order)
     {
         // This assertion is valid only if all nodal d.o.f. use the same shape
@@ -126,18 +128,12 @@ public:
         vars[static_cast<int>(MaterialPropertyLib::Variable::phase_pressure)] =
             p_int_pt;
 
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& liquid_phase = medium.phase("AqueousLiquid");
-
         // fetch permeability, viscosity, density
         auto const K = MaterialPropertyLib::formEigenTensor<GlobalDim>(
-            medium.property(MaterialPropertyLib::PropertyType::permeability)
-                .value(vars, pos, t));
+            _material.permeability.value(vars, pos, t));
 
         auto const mu =
-            liquid_phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                .template value<double>(vars, pos, t);
+            _material.liquid_viscosity.template value<double>(vars, pos, t);
         GlobalDimMatrixType const K_over_mu = K / mu;
 
         auto const p_nodal_values = Eigen::Map<const NodalVectorType>(
@@ -148,9 +144,7 @@ public:
         if (this->_process_data.has_gravity)
         {
             auto const rho_w =
-                liquid_phase
-                    .property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars, pos, t);
+                _material.liquid_density.template value<double>(vars, pos, t);
             auto const b = this->_process_data.specific_body_force;
             q += K_over_mu * rho_w * b;
         }
@@ -163,6 +157,7 @@ public:
 protected:
     MeshLib::Element const& _element;
     HTProcessData const& _process_data;
+    HTElementMaterial const _material;
 
     IntegrationMethod const _integration_method;
     std::vector<
@@ -176,19 +171,12 @@ protected:
         const double fluid_density, const double specific_heat_capacity_fluid,
         ParameterLib::SpatialPosition const& pos, double const t)
     {
-        auto const& medium =
-            *_process_data.media_map->getMedium(this->_element.getID());
-        auto const& solid_phase = medium.phase("Solid");
-
         auto const specific_heat_capacity_solid =
-            solid_phase
-                .property(
-                    MaterialPropertyLib::PropertyType::specific_heat_capacity)
-                .template value<double>(vars, pos, t);
+            _material.solid_specific_heat_capacity.template value<double>(
+                vars, pos, t);
 
         auto const solid_density =
-            solid_phase.property(MaterialPropertyLib::PropertyType::density)
-                .template value<double>(vars, pos, t);
+            _material.solid_density.template value<double>(vars, pos, t);
 
         return solid_density * specific_heat_capacity_solid * (1 - porosity) +
                fluid_density * specific_heat_capacity_fluid * porosity;
@@ -200,22 +188,12 @@ protected:
         const GlobalDimVectorType& velocity, const GlobalDimMatrixType& I,
         ParameterLib::SpatialPosition const& pos, double const t)
     {
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& solid_phase = medium.phase("Solid");
-        auto const& liquid_phase = medium.phase("AqueousLiquid");
-
         auto const thermal_conductivity_solid =
-            solid_phase
-                .property(
-                    MaterialPropertyLib::PropertyType::thermal_conductivity)
-                .value(vars, pos, t);
+            _material.solid_thermal_conductivity.value(vars, pos, t);
 
         auto const thermal_conductivity_fluid =
-            liquid_phase
-                .property(
-                    MaterialPropertyLib::PropertyType::thermal_conductivity)
-                .template value<double>(vars, pos, t);
+            _material.liquid_thermal_conductivity.template value<double>(
+                vars, pos, t);
 
         auto const thermal_conductivity =
             MaterialPropertyLib::formEffectiveThermalConductivity<GlobalDim>(
@@ -223,14 +201,10 @@ protected:
                 porosity);
 
         auto const thermal_dispersivity_longitudinal =
-            medium
-                .property(MaterialPropertyLib::PropertyType::
-                              thermal_longitudinal_dispersivity)
+            _material.thermal_longitudinal_dispersivity
                 .template value<double>();
         auto const thermal_dispersivity_transversal =
-            medium
-                .property(MaterialPropertyLib::PropertyType::
-                              thermal_transversal_dispersivity)
+            _material.thermal_transversal_dispersivity
                 .template value<double>();
 
         double const velocity_magnitude = velocity.norm();
@@ -277,10 +251,6 @@ protected:
         auto const p_nodal_values = Eigen::Map<const NodalVectorType>(
             &local_p[0], ShapeFunction::NPOINTS);
 
-        auto const& medium =
-            *_process_data.media_map->getMedium(_element.getID());
-        auto const& liquid_phase = medium.phase("AqueousLiquid");
-
         for (unsigned ip = 0; ip < n_integration_points; ++ip)
         {
             auto const& ip_data = _ip_data[ip];
@@ -300,13 +270,10 @@ protected:
                 MaterialPropertyLib::Variable::phase_pressure)] = p_int_pt;
 
             auto const K = MaterialPropertyLib::formEigenTensor<GlobalDim>(
-                medium.property(MaterialPropertyLib::PropertyType::permeability)
-                    .value(vars, pos, t));
+                _material.permeability.value(vars, pos, t));
 
             auto const mu =
-                liquid_phase
-                    .property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t);
+                _material.liquid_viscosity.template value<double>(vars, pos, t);
             GlobalDimMatrixType const K_over_mu = K / mu;
 
             cache_mat.col(ip).noalias() = -K_over_mu * dNdx * p_nodal_values;
@@ -314,9 +281,8 @@ protected:
             if (_process_data.has_gravity)
             {
                 auto const rho_w =
-                    liquid_phase
-                        .property(MaterialPropertyLib::PropertyType::density)
-                        .template value<double>(vars, pos, t);
+                    _material.liquid_density.template value<double>(vars, pos,
+                                                                    t);
                 auto const b = _process_data.specific_body_force;
                 // here it is assumed that the vector b is directed 'downwards'
                 cache_mat.col(ip).noalias() += K_over_mu * rho_w * b;
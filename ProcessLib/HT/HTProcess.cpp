@@ -11,12 +11,15 @@
 #include "HTProcess.h"
 
 #include <cassert>
+#include <unordered_set>
 
+#include "MaterialLib/MPL/Properties/Constant.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "ProcessLib/SurfaceFlux/SurfaceFluxData.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
+#include "HTElementMaterial.h"
 #include "MonolithicHTFEM.h"
 #include "StaggeredHTFEM.h"
 
@@ -54,6 +57,12 @@ void HTProcess::initializeConcreteProcess(
     unsigned const integration_order)
 {
     checkMPLProperties(mesh, _process_data);
+    _is_mass_matrix_constant =
+        _use_monolithic_scheme && hasConstantMassMatrix(mesh, _process_data);
+    if (_is_mass_matrix_constant)
+    {
+        INFO("HT: The mass matrix is constant and will be assembled once.");
+    }
 
     // For the staggered scheme, both processes are assumed to use the same
     // element order. Therefore the order of shape function can be fetched from
@@ -308,6 +317,15 @@ void checkMPLProperties(MeshLib::Mesh const& mesh,
         {
             OGS_FATAL("The permeability for the porous media isn't specified.");
         }
+        if (!medium.hasProperty(MaterialPropertyLib::PropertyType::
+                                    thermal_longitudinal_dispersivity) ||
+            !medium.hasProperty(MaterialPropertyLib::PropertyType::
+                                    thermal_transversal_dispersivity))
+        {
+            OGS_FATAL(
+                "The thermal dispersivities for the porous media aren't "
+                "specified.");
+        }
 
         // check if liquid phase definition and the corresponding properties
         // exists
@@ -331,6 +349,13 @@ void checkMPLProperties(MeshLib::Mesh const& mesh,
                 "The specific heat capacity for the AqueousLiquid phase "
                 "isn't specified.");
         }
+        if (!liquid_phase.hasProperty(
+                MaterialPropertyLib::PropertyType::thermal_conductivity))
+        {
+            OGS_FATAL(
+                "The thermal conductivity for the AqueousLiquid phase isn't "
+                "specified.");
+        }
 
         // check if solid phase definition and the corresponding properties
         // exists
@@ -352,8 +377,47 @@ void checkMPLProperties(MeshLib::Mesh const& mesh,
         {
             OGS_FATAL("The storage for the Solid phase isn't specified.");
         }
+        if (!solid_phase.hasProperty(
+                MaterialPropertyLib::PropertyType::thermal_conductivity))
+        {
+            OGS_FATAL(
+                "The thermal conductivity for the Solid phase isn't "
+                "specified.");
+        }
     }
     DBUG("Media properties verified.");
 }
+
+bool hasConstantMassMatrix(MeshLib::Mesh const& mesh,
+                           HTProcessData const& process_data)
+{
+    auto const is_constant = [](MaterialPropertyLib::Property const& p) {
+        return dynamic_cast<MaterialPropertyLib::Constant const*>(&p) !=
+               nullptr;
+    };
+
+    std::unordered_set<MaterialPropertyLib::Medium const*> checked_media;
+    for (auto const& element : mesh.getElements())
+    {
+        auto const& medium =
+            *process_data.media_map->getMedium(element->getID());
+        if (!checked_media.insert(&medium).second)
+        {
+            continue;
+        }
+
+        HTElementMaterial const material(medium);
+        if (!is_constant(material.porosity) ||
+            !is_constant(material.liquid_density) ||
+            !is_constant(material.liquid_specific_heat_capacity) ||
+            !is_constant(material.solid_density) ||
+            !is_constant(material.solid_storage) ||
+            !is_constant(material.solid_specific_heat_capacity))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 }  // namespace HT
 }  // namespace ProcessLib
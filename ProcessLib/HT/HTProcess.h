@@ -105,6 +105,12 @@ private:
         int const process_id, GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
         GlobalMatrix& Jac) override;
 
+    bool isMassMatrixConstantConcreteProcess(
+        int const /*process_id*/) const override
+    {
+        return _is_mass_matrix_constant;
+    }
+
     void preTimestepConcreteProcess(std::vector<GlobalVector*> const& x,
                                     double const t, double const dt,
                                     const int process_id) override;
@@ -133,10 +139,18 @@ private:
 
     const int _heat_transport_process_id;
     const int _hydraulic_process_id;
+
+    /// Set in initializeConcreteProcess(), cf. isMassMatrixConstant().
+    bool _is_mass_matrix_constant = false;
 };
 
 void checkMPLProperties(MeshLib::Mesh const& mesh,
                         HTProcessData const& process_data);
 
+/// Returns true if all properties entering the mass matrix of the monolithic
+/// HT process are constant in all media of the mesh.
+bool hasConstantMassMatrix(MeshLib::Mesh const& mesh,
+                           HTProcessData const& process_data);
+
 }  // namespace HT
 }  // namespace ProcessLib
@@ -101,10 +101,7 @@ public:
             &local_x[pressure_index], pressure_size);
 
         auto const& process_data = this->_process_data;
-        auto const& medium =
-            *process_data.media_map->getMedium(this->_element.getID());
-        auto const& liquid_phase = medium.phase("AqueousLiquid");
-        auto const& solid_phase = medium.phase("Solid");
+        auto const& material = this->_material;
 
         auto const& b = process_data.specific_body_force;
 
@@ -138,36 +135,26 @@ public:
             // \todo the argument to getValue() has to be changed for non
             // constant storage model
             auto const specific_storage =
-                solid_phase.property(MaterialPropertyLib::PropertyType::storage)
-                    .template value<double>(vars, pos, t);
+                material.solid_storage.template value<double>(vars, pos, t);
 
             auto const porosity =
-                medium.property(MaterialPropertyLib::PropertyType::porosity)
-                    .template value<double>(vars, pos, t);
+                material.porosity.template value<double>(vars, pos, t);
 
             auto const intrinsic_permeability =
                 MaterialPropertyLib::formEigenTensor<GlobalDim>(
-                    medium
-                        .property(
-                            MaterialPropertyLib::PropertyType::permeability)
-                        .value(vars, pos, t));
+                    material.permeability.value(vars, pos, t));
 
             auto const specific_heat_capacity_fluid =
-                liquid_phase
-                    .property(MaterialPropertyLib::specific_heat_capacity)
-                    .template value<double>(vars, pos, t);
+                material.liquid_specific_heat_capacity.template value<double>(
+                    vars, pos, t);
 
             // Use the fluid density model to compute the density
             auto const fluid_density =
-                liquid_phase
-                    .property(MaterialPropertyLib::PropertyType::density)
-                    .template value<double>(vars, pos, t);
+                material.liquid_density.template value<double>(vars, pos, t);
 
             // Use the viscosity model to compute the viscosity
             auto const viscosity =
-                liquid_phase
-                    .property(MaterialPropertyLib::PropertyType::viscosity)
-                    .template value<double>(vars, pos, t);
+                material.liquid_viscosity.template value<double>(vars, pos, t);
             GlobalDimMatrixType K_over_mu = intrinsic_permeability / viscosity;
 
             GlobalDimVectorType const velocity =
@@ -75,10 +75,7 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
     pos.setElementID(this->_element.getID());
 
     auto const& process_data = this->_process_data;
-    auto const& medium = *this->_process_data.media_map->getMedium(
-        this->_element.getID());
-    auto const& liquid_phase = medium.phase("AqueousLiquid");
-    auto const& solid_phase = medium.phase("Solid");
+    auto const& material = this->_material;
 
     auto const& b = process_data.specific_body_force;
 
@@ -107,33 +104,26 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
             p_int_pt;
 
         auto const porosity =
-            medium.property(MaterialPropertyLib::PropertyType::porosity)
-                .template value<double>(vars, pos, t);
+            material.porosity.template value<double>(vars, pos, t);
         auto const fluid_density =
-            liquid_phase.property(MaterialPropertyLib::PropertyType::density)
-                .template value<double>(vars, pos, t);
+            material.liquid_density.template value<double>(vars, pos, t);
 
         const double dfluid_density_dp =
-            liquid_phase.property(MaterialPropertyLib::PropertyType::density)
-                .template dValue<double>(
-                    vars, MaterialPropertyLib::Variable::phase_pressure, pos,
-                    t);
+            material.liquid_density.template dValue<double>(
+                vars, MaterialPropertyLib::Variable::phase_pressure, pos, t);
 
         // Use the viscosity model to compute the viscosity
         auto const viscosity =
-            liquid_phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                .template value<double>(vars, pos, t);
+            material.liquid_viscosity.template value<double>(vars, pos, t);
 
         // \todo the argument to getValue() has to be changed for non
         // constant storage model
         auto const specific_storage =
-            solid_phase.property(MaterialPropertyLib::PropertyType::storage)
-                .template value<double>(vars, pos, t);
+            material.solid_storage.template value<double>(vars, pos, t);
 
         auto const intrinsic_permeability =
             MaterialPropertyLib::formEigenTensor<GlobalDim>(
-                medium.property(MaterialPropertyLib::PropertyType::permeability)
-                    .value(vars, pos, t));
+                material.permeability.value(vars, pos, t));
         GlobalDimMatrixType const K_over_mu =
             intrinsic_permeability / viscosity;
 
@@ -161,11 +151,8 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
             auto const solid_thermal_expansion =
                 process_data.solid_thermal_expansion(t, pos)[0];
             const double dfluid_density_dT =
-                liquid_phase
-                    .property(MaterialPropertyLib::PropertyType::density)
-                    .template dValue<double>(
-                        vars, MaterialPropertyLib::Variable::temperature, pos,
-                        t);
+                material.liquid_density.template dValue<double>(
+                    vars, MaterialPropertyLib::Variable::temperature, pos, t);
             double T0_int_pt = 0.;
             NumLib::shapeFunctionInterpolate(local_T0, N, T0_int_pt);
             auto const biot_constant =
@@ -203,9 +190,7 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
     pos.setElementID(this->_element.getID());
 
     auto const& process_data = this->_process_data;
-    auto const& medium =
-        *process_data.media_map->getMedium(this->_element.getID());
-    auto const& liquid_phase = medium.phase("AqueousLiquid");
+    auto const& material = this->_material;
 
     auto const& b = process_data.specific_body_force;
 
@@ -237,16 +222,14 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
             p_at_xi;
 
         auto const porosity =
-            medium.property(MaterialPropertyLib::PropertyType::porosity)
-                .template value<double>(vars, pos, t);
+            material.porosity.template value<double>(vars, pos, t);
 
         // Use the fluid density model to compute the density
         auto const fluid_density =
-            liquid_phase.property(MaterialPropertyLib::PropertyType::density)
-                .template value<double>(vars, pos, t);
+            material.liquid_density.template value<double>(vars, pos, t);
         auto const specific_heat_capacity_fluid =
-            liquid_phase.property(MaterialPropertyLib::specific_heat_capacity)
-                .template value<double>(vars, pos, t);
+            material.liquid_specific_heat_capacity.template value<double>(
+                vars, pos, t);
 
         // Assemble mass matrix
         local_M.noalias() += w *
@@ -257,14 +240,11 @@ void StaggeredHTFEM<ShapeFunction, IntegrationMethod, GlobalDim>::
 
         // Assemble Laplace matrix
         auto const viscosity =
-            liquid_phase.property(MaterialPropertyLib::PropertyType::viscosity)
-                .template value<double>(vars, pos, t);
+            material.liquid_viscosity.template value<double>(vars, pos, t);
 
         auto const intrinsic_permeability =
             MaterialPropertyLib::formEigenTensor<GlobalDim>(
-                medium
-                    .property(MaterialPropertyLib::PropertyType::permeability)
-                    .value(vars, pos, t));
+                material.permeability.value(vars, pos, t));
 
         GlobalDimMatrixType const K_over_mu =
             intrinsic_permeability / viscosity;
@@ -18,6 +18,7 @@
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "ParameterLib/Parameter.h"
+#include "ProcessLib/ForwardADJacobianAssembler.h"
 #include "ProcessLib/LocalAssemblerInterface.h"
 #include "ProcessLib/LocalAssemblerTraits.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
@@ -129,6 +130,24 @@ public:
         }
     }
 
+    void assembleWithJacobianForwardAD(
+        double const t, double const /*dt*/,
+        std::vector<double> const& local_x,
+        std::vector<double> const& local_xdot, const double dxdot_dx,
+        const double dx_dx, std::vector<double>& /*local_M_data*/,
+        std::vector<double>& /*local_K_data*/,
+        std::vector<double>& local_b_data,
+        std::vector<double>& local_Jac_data) override
+    {
+        assembleResidualWithDualNumbers<ShapeFunction::NPOINTS *
+                                        NUM_NODAL_DOF>(
+            [&](auto const& T, auto const& T_dot, auto& r) {
+                assembleResidual(t, T, T_dot, r);
+            },
+            local_x, local_xdot, dxdot_dx, dx_dx, local_b_data,
+            local_Jac_data);
+    }
+
     void computeSecondaryVariableConcrete(
         const double t, std::vector<double> const& local_x) override
     {
@@ -200,6 +219,34 @@ public:
     }
 
 private:
+    /// Residual \f$ r = M \dot T + K T \f$ for any scalar type of the
+    /// temperatures, e.g., dual numbers.
+    template <typename Vector>
+    void assembleResidual(double const t, Vector const& T,
+                          Vector const& T_dot, Vector& r) const
+    {
+        unsigned const n_integration_points =
+            _integration_method.getNumberOfPoints();
+
+        ParameterLib::SpatialPosition pos;
+        pos.setElementID(_element.getID());
+
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            pos.setIntegrationPoint(ip);
+            auto const& sm = _shape_matrices[ip];
+            auto const& wp = _integration_method.getWeightedPoint(ip);
+            auto const k = _process_data.thermal_conductivity(t, pos)[0];
+            auto const heat_capacity = _process_data.heat_capacity(t, pos)[0];
+            auto const density = _process_data.density(t, pos)[0];
+            double const w = sm.detJ * wp.getWeight() * sm.integralMeasure;
+
+            r.noalias() += sm.N.transpose() * (density * heat_capacity * w) *
+                               (sm.N * T_dot).eval() +
+                           sm.dNdx.transpose() * (k * w) * (sm.dNdx * T).eval();
+        }
+    }
+
     MeshLib::Element const& _element;
     HeatConductionProcessData const& _process_data;
 
@@ -61,6 +61,13 @@ private:
         GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
         GlobalMatrix& Jac) override;
 
+    bool isMassMatrixConstantConcreteProcess(
+        int const /*process_id*/) const override
+    {
+        return !_process_data.heat_capacity.isTimeDependent() &&
+               !_process_data.density.isTimeDependent();
+    }
+
     HeatConductionProcessData _process_data;
 
     std::vector<std::unique_ptr<HeatConductionLocalAssemblerInterface>>
@@ -10,6 +10,18 @@ AddTest(
     REQUIREMENTS NOT OGS_USE_MPI
 )
 
+AddTest(
+        NAME 1D_HeatConduction_dirichlet_ForwardAD
+        PATH Parabolic/T/1D_dirichlet
+        EXECUTABLE ogs
+        EXECUTABLE_ARGS line_60_heat_ForwardAD.prj
+        TESTER vtkdiff
+        DIFF_DATA
+        temperature_analytical.vtu line_60_heat_ForwardAD_pcs_0_ts_65_t_5078125.000000.vtu Temperature_Analytical_2months temperature 1e-5 1e-5
+        temperature_analytical.vtu line_60_heat_ForwardAD_pcs_0_ts_405_t_31640625.000000.vtu Temperature_Analytical_1year temperature 1e-5 1e-5
+    REQUIREMENTS NOT OGS_USE_MPI
+)
+
 AddTest(
         NAME 1D_HeatConduction_neumann
         PATH Parabolic/T/1D_neumann
@@ -16,6 +16,7 @@
 #include "MaterialLib/SolidModels/MechanicsBase.h"
 #include "ParameterLib/Utils.h"
 #include "ProcessLib/Output/CreateSecondaryVariables.h"
+#include "ProcessLib/Utils/IntegrationOrders.h"
 #include "ProcessLib/Utils/ProcessUtils.h"
 
 #include "HydroMechanicsProcess.h"
@@ -223,7 +224,8 @@ std::unique_ptr<Process> createHydroMechanicsProcess(
         biot_coefficient,      porosity,
         solid_density,         specific_body_force,
         fluid_compressibility, reference_temperature,
-        specific_gas_constant, fluid_type};
+        specific_gas_constant, fluid_type,
+        createIntegrationOrdersPerMaterial(config)};
 
     SecondaryVariableCollection secondary_variables;
 
@@ -17,6 +17,7 @@
 #include "MathLib/KelvinVector.h"
 #include "NumLib/Function/Interpolation.h"
 #include "ProcessLib/CoupledSolutionsForStaggeredScheme.h"
+#include "ProcessLib/Utils/IntegrationOrders.h"
 
 namespace ProcessLib
 {
@@ -33,7 +34,10 @@ HydroMechanicsLocalAssembler<ShapeFunctionDisplacement, ShapeFunctionPressure,
         unsigned const integration_order,
         HydroMechanicsProcessData<DisplacementDim>& process_data)
     : _process_data(process_data),
-      _integration_method(integration_order),
+      _integration_method(
+          getIntegrationOrder(process_data.integration_orders_per_material,
+                              process_data.material_ids, e.getID(),
+                              integration_order)),
       _element(e),
       _is_axially_symmetric(is_axially_symmetric)
 {
@@ -24,6 +24,7 @@
 #include "ProcessLib/Deformation/LinearBMatrix.h"
 #include "ProcessLib/LocalAssemblerTraits.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
+#include "ProcessLib/Utils/IntegrationPointDataVector.h"
 
 #include "HydroMechanicsProcessData.h"
 #include "LocalAssemblerInterface.h"
@@ -451,7 +452,7 @@ private:
         IntegrationPointData<BMatricesType, ShapeMatricesTypeDisplacement,
                              ShapeMatricesTypePressure, DisplacementDim,
                              ShapeFunctionDisplacement::NPOINTS>;
-    std::vector<IpData, Eigen::aligned_allocator<IpData>> _ip_data;
+    IntegrationPointDataVector<IpData> _ip_data;
 
     IntegrationMethod _integration_method;
     MeshLib::Element const& _element;
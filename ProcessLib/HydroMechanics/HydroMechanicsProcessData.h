@@ -13,6 +13,7 @@
 #include "ParameterLib/Parameter.h"
 #include "MaterialLib/Fluid/FluidType/FluidType.h"
 
+#include <map>
 #include <memory>
 #include <utility>
 
@@ -84,6 +85,10 @@ struct HydroMechanicsProcessData
     /// incompressible_fluid, compressible_fluid, ideal_gas
     FluidType::Fluid_Type const fluid_type;
 
+    /// Integration orders deviating from the process' integration order for
+    /// the elements of single material ids.
+    std::map<int, unsigned> const integration_orders_per_material;
+
     /// will be removed after linking with MPL
     double getFluidDensity(
         double const& t, ParameterLib::SpatialPosition const& x_position,
@@ -68,6 +68,20 @@ void LocalAssemblerInterface::assembleWithJacobianForStaggeredScheme(
         " the local assembler.");
 }
 
+void LocalAssemblerInterface::assembleWithJacobianForwardAD(
+    double const /*t*/, double const /*dt*/,
+    std::vector<double> const& /*local_x*/,
+    std::vector<double> const& /*local_xdot*/, const double /*dxdot_dx*/,
+    const double /*dx_dx*/, std::vector<double>& /*local_M_data*/,
+    std::vector<double>& /*local_K_data*/,
+    std::vector<double>& /*local_b_data*/,
+    std::vector<double>& /*local_Jac_data*/)
+{
+    OGS_FATAL(
+        "The assembleWithJacobianForwardAD() function is not implemented in "
+        "the local assembler.");
+}
+
 void LocalAssemblerInterface::computeSecondaryVariable(
     std::size_t const mesh_item_id,
     NumLib::LocalToGlobalIndexMap const& dof_table, double const t,
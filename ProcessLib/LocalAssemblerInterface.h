@@ -75,6 +75,16 @@ public:
         std::vector<double>& local_b_data, std::vector<double>& local_Jac_data,
         LocalCoupledSolutions const& local_coupled_solutions);
 
+    //! Assembles the local residual and its exact Jacobian by evaluating the
+    //! residual with dual numbers, cf. assembleResidualWithDualNumbers(). Used
+    //! by the ForwardADJacobianAssembler.
+    virtual void assembleWithJacobianForwardAD(
+        double const t, double const dt, std::vector<double> const& local_x,
+        std::vector<double> const& local_xdot, const double dxdot_dx,
+        const double dx_dx, std::vector<double>& local_M_data,
+        std::vector<double>& local_K_data, std::vector<double>& local_b_data,
+        std::vector<double>& local_Jac_data);
+
     virtual void computeSecondaryVariable(
         std::size_t const mesh_item_id,
         NumLib::LocalToGlobalIndexMap const& dof_table, const double t,
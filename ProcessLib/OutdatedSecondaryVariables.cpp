@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "OutdatedSecondaryVariables.h"
+
+namespace ProcessLib
+{
+void OutdatedSecondaryVariables::markOutdated(int const process_id)
+{
+    if (static_cast<std::size_t>(process_id) >= _is_outdated.size())
+    {
+        _is_outdated.resize(process_id + 1, false);
+    }
+    _is_outdated[process_id] = true;
+}
+
+bool OutdatedSecondaryVariables::isOutdated(int const process_id) const
+{
+    return static_cast<std::size_t>(process_id) < _is_outdated.size() &&
+           _is_outdated[process_id];
+}
+
+void OutdatedSecondaryVariables::computeOutdated(double const t)
+{
+    for (std::size_t process_id = 0; process_id < _is_outdated.size();
+         ++process_id)
+    {
+        if (!_is_outdated[process_id])
+        {
+            continue;
+        }
+        _is_outdated[process_id] = false;
+        _compute(t, static_cast<int>(process_id));
+    }
+}
+
+}  // namespace ProcessLib
@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ProcessLib
+{
+/// Keeps track of the processes, whose secondary variables do not belong to
+/// the current solution, because their computation was deferred until they
+/// are needed, e.g., for output.
+class OutdatedSecondaryVariables
+{
+public:
+    /// Computes the secondary variables of the process with the given id for
+    /// its current solution at time \c t.
+    using Computation =
+        std::function<void(double const t, int const process_id)>;
+
+    explicit OutdatedSecondaryVariables(Computation compute)
+        : _compute(std::move(compute))
+    {
+    }
+
+    /// Marks the secondary variables of the process as not matching its
+    /// current solution.
+    void markOutdated(int const process_id);
+
+    bool isOutdated(int const process_id) const;
+
+    /// Computes the secondary variables of all processes marked as outdated
+    /// and resets the marks.
+    void computeOutdated(double const t);
+
+private:
+    Computation const _compute;
+    /// Indexed by the process id.
+    std::vector<bool> _is_outdated;
+};
+
+}  // namespace ProcessLib
@@ -57,7 +57,7 @@ std::string constructFileName(std::string const& prefix,
 
 namespace ProcessLib
 {
-bool Output::shallDoOutput(int timestep, double const t)
+bool Output::isOutputStep(int timestep, double const t) const
 {
     int each_steps = 1;
 
@@ -75,21 +75,28 @@ bool Output::shallDoOutput(int timestep, double const t)
         }
     }
 
-    bool make_output = timestep % each_steps == 0;
+    return timestep % each_steps == 0 || isFixedOutputTime(t);
+}
 
+bool Output::isFixedOutputTime(double const t) const
+{
     if (_fixed_output_times.empty())
     {
-        return make_output;
+        return false;
     }
 
     const double specific_time = _fixed_output_times.back();
     const double zero_threshold = std::numeric_limits<double>::min();
-    if (std::fabs(specific_time - t) < zero_threshold)
+    return std::fabs(specific_time - t) < zero_threshold;
+}
+
+bool Output::shallDoOutput(int const timestep, double const t)
+{
+    bool const make_output = isOutputStep(timestep, t);
+    if (isFixedOutputTime(t))
     {
         _fixed_output_times.pop_back();
-        make_output = true;
     }
-
     return make_output;
 }
 
@@ -188,6 +195,14 @@ void Output::outputBulkMesh(OutputFile const& output_file,
                output_file.data_mode);
 }
 
+void Output::trackOutputBufferMemory(std::string const& mesh_name,
+                                     std::size_t const bytes)
+{
+    _output_buffer_memory
+        .emplace(mesh_name, BaseLib::MemoryTag::OutputBuffers)
+        .first->second.set(bytes);
+}
+
 void Output::doOutputAlways(Process const& process,
                             const int process_id,
                             const int timestep,
@@ -206,11 +221,14 @@ void Output::doOutputAlways(Process const& process,
 
     bool output_secondary_variable = true;
     // Need to add variables of process to vtu even no output takes place.
-    processOutputData(t, x, process_id, process.getMesh(), dof_tables,
-                      process.getProcessVariables(process_id),
-                      process.getSecondaryVariables(),
-                      output_secondary_variable,
-                      process.getIntegrationPointWriter(), _process_output);
+    trackOutputBufferMemory(
+        process.getMesh().getName(),
+        processOutputData(t, x, process_id, process.getMesh(), dof_tables,
+                          process.getProcessVariables(process_id),
+                          process.getSecondaryVariables(),
+                          output_secondary_variable,
+                          process.getIntegrationPointWriter(),
+                          _process_output));
 
     // For the staggered scheme for the coupling, only the last process, which
     // gives the latest solution within a coupling loop, is allowed to make
@@ -274,11 +292,14 @@ void Output::doOutputAlways(Process const& process,
                   });
 
         output_secondary_variable = false;
-        processOutputData(t, x, process_id, mesh, mesh_dof_table_pointers,
-                          process.getProcessVariables(process_id),
-                          process.getSecondaryVariables(),
-                          output_secondary_variable,
-                          process.getIntegrationPointWriter(), _process_output);
+        trackOutputBufferMemory(
+            mesh.getName(),
+            processOutputData(t, x, process_id, mesh, mesh_dof_table_pointers,
+                              process.getProcessVariables(process_id),
+                              process.getSecondaryVariables(),
+                              output_secondary_variable,
+                              process.getIntegrationPointWriter(),
+                              _process_output));
 
         // TODO (TomFischer): add pvd support here. This can be done if the
         // output is mesh related instead of process related. This would also
@@ -354,11 +375,14 @@ void Output::doOutputNonlinearIteration(Process const& process,
     }
 
     bool const output_secondary_variable = true;
-    processOutputData(t, x, process_id, process.getMesh(), dof_tables,
-                      process.getProcessVariables(process_id),
-                      process.getSecondaryVariables(),
-                      output_secondary_variable,
-                      process.getIntegrationPointWriter(), _process_output);
+    trackOutputBufferMemory(
+        process.getMesh().getName(),
+        processOutputData(t, x, process_id, process.getMesh(), dof_tables,
+                          process.getProcessVariables(process_id),
+                          process.getSecondaryVariables(),
+                          output_secondary_variable,
+                          process.getIntegrationPointWriter(),
+                          _process_output));
 
     // For the staggered scheme for the coupling, only the last process, which
     // gives the latest solution within a coupling loop, is allowed to make
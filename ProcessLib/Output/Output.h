@@ -13,6 +13,7 @@
 #include <map>
 #include <utility>
 
+#include "BaseLib/MemoryAccounting.h"
 #include "MeshLib/IO/VtkIO/PVDFile.h"
 #include "ProcessOutput.h"
 
@@ -79,6 +80,10 @@ public:
 
     std::vector<double> getFixedOutputTimes() {return _fixed_output_times;}
 
+    //! Tells if doOutput() will write output for the given \c timestep or
+    //! \c t.
+    bool isOutputStep(int timestep, double const t) const;
+
 private:
     struct ProcessData
     {
@@ -95,6 +100,11 @@ private:
                         MeshLib::Mesh const& mesh,
                         double const t) const;
 
+    /// Accounts the size of the output data written to the properties of the
+    /// given mesh.
+    void trackOutputBufferMemory(std::string const& mesh_name,
+                                 std::size_t const bytes);
+
 private:
     std::string const _output_directory;
     std::string const _output_file_prefix;
@@ -124,12 +134,17 @@ private:
      */
     ProcessData* findProcessData(Process const& process, const int process_id);
 
-    //! Determines if there should be output at the given \c timestep or \c t.
-    bool shallDoOutput(int timestep, double const t);
+    //! Determines if there should be output at the given \c timestep or \c t
+    //! and removes \c t from the fixed output times.
+    bool shallDoOutput(int const timestep, double const t);
+
+    bool isFixedOutputTime(double const t) const;
 
     ProcessOutput const _process_output;
     std::vector<std::string> const _mesh_names_for_output;
     std::vector<std::unique_ptr<MeshLib::Mesh>> const& _meshes;
+
+    std::map<std::string, BaseLib::TrackedMemory> _output_buffer_memory;
 };
 
 
@@ -29,7 +29,7 @@ static void addOgsVersion(MeshLib::Mesh& mesh)
                              GitInfoLib::GitInfo::ogs_version.end());
 }
 
-static void addSecondaryVariableNodes(
+static std::size_t addSecondaryVariableNodes(
     double const t,
     std::vector<GlobalVector*> const& x,
     std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
@@ -72,9 +72,10 @@ static void addSecondaryVariableNodes(
 
     // Copy result
     nodal_values.copyValues(nodal_values_mesh);
+    return nodal_values_mesh.size() * sizeof(double);
 }
 
-static void addSecondaryVariableResiduals(
+static std::size_t addSecondaryVariableResiduals(
     double const t,
     std::vector<GlobalVector*> const& x,
     std::vector<NumLib::LocalToGlobalIndexMap const*> const& dof_table,
@@ -84,7 +85,7 @@ static void addSecondaryVariableResiduals(
 {
     if (!var.fcts.eval_residuals)
     {
-        return;
+        return 0;
     }
 
     DBUG("  secondary variable %s residual", output_name.c_str());
@@ -123,11 +124,12 @@ static void addSecondaryVariableResiduals(
 
     // Copy result
     residuals.copyValues(residuals_mesh);
+    return residuals_mesh.size() * sizeof(double);
 }
 
 namespace ProcessLib
 {
-void processOutputData(
+std::size_t processOutputData(
     const double t,
     std::vector<GlobalVector*> const& x,
     int const process_id,
@@ -159,6 +161,7 @@ void processOutputData(
 
     auto const& output_variables = process_output.output_variables;
     std::set<std::string> already_output;
+    std::size_t output_bytes = 0;
 
     int global_component_offset = 0;
     int global_component_offset_next = 0;
@@ -195,7 +198,7 @@ void processOutputData(
         auto const num_comp = pv.getNumberOfComponents();
         auto& output_data = *MeshLib::getOrCreateMeshProperty<double>(
             mesh, pv.getName(), MeshLib::MeshItemType::Node, num_comp);
-
+        output_bytes += output_data.size() * sizeof(double);
 
         for (int component_id = 0; component_id < num_comp; ++component_id)
         {
@@ -230,18 +233,20 @@ void processOutputData(
                 continue;
             }
 
-            addSecondaryVariableNodes(
+            output_bytes += addSecondaryVariableNodes(
                 t, x, dof_table, secondary_variables.get(name), name, mesh);
 
             if (process_output.output_residuals)
             {
-                addSecondaryVariableResiduals(
+                output_bytes += addSecondaryVariableResiduals(
                     t, x, dof_table, secondary_variables.get(name), name, mesh);
             }
         }
     }
 
     addIntegrationPointWriter(mesh, integration_point_writer);
+
+    return output_bytes;
 }
 
 void makeOutput(std::string const& file_name, MeshLib::Mesh const& mesh,
@@ -29,7 +29,9 @@ struct ProcessOutput final
 
 ///
 /// Prepare the output data, i.e. add the solution to vtu data structure.
-void processOutputData(
+/// Returns the size in bytes of the nodal and cell output data written to the
+/// mesh properties.
+std::size_t processOutputData(
     const double t,
     std::vector<GlobalVector*> const& x,
     int const process_id,
@@ -10,6 +10,9 @@
 
 #include "Process.h"
 
+#include <algorithm>
+
+#include "BaseLib/EventTracer.h"
 #include "NumLib/DOF/ComputeSparsityPattern.h"
 #include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
@@ -196,8 +199,14 @@ void Process::assemble(const double t, double const dt,
 {
     MathLib::LinAlg::setLocalAccessibleVector(*x[process_id]);
 
-    assembleConcreteProcess(t, dt, x, process_id, M, K, b);
+    {
+        BaseLib::TraceScope const trace_assembly("local assembly",
+                                                 "ProcessLib");
+        assembleConcreteProcess(t, dt, x, process_id, M, K, b);
+    }
 
+    BaseLib::TraceScope const trace_bcs("natural BCs and source terms",
+                                        "ProcessLib");
     // the last argument is for the jacobian, nullptr is for a unused jacobian
     _boundary_conditions[process_id].applyNaturalBC(t, x, process_id, K, b,
                                                     nullptr);
@@ -218,9 +227,15 @@ void Process::assembleWithJacobian(const double t, double const dt,
     MathLib::LinAlg::setLocalAccessibleVector(*x[process_id]);
     MathLib::LinAlg::setLocalAccessibleVector(xdot);
 
-    assembleWithJacobianConcreteProcess(t, dt, x, xdot, dxdot_dx, dx_dx,
-                                        process_id, M, K, b, Jac);
+    {
+        BaseLib::TraceScope const trace_assembly("local assembly",
+                                                 "ProcessLib");
+        assembleWithJacobianConcreteProcess(t, dt, x, xdot, dxdot_dx, dx_dx,
+                                            process_id, M, K, b, Jac);
+    }
 
+    BaseLib::TraceScope const trace_bcs("natural BCs and source terms",
+                                        "ProcessLib");
     // TODO: apply BCs to Jacobian.
     _boundary_conditions[process_id].applyNaturalBC(t, x, process_id, K, b,
                                                     &Jac);
@@ -229,6 +244,20 @@ void Process::assembleWithJacobian(const double t, double const dt,
     _source_term_collections[process_id].integrate(t, *x[process_id], b, &Jac);
 }
 
+bool Process::isMassMatrixConstant(int const process_id) const
+{
+    // Deactivated subdomains change the mass matrix when they are activated.
+    auto const& variables = _process_variables[process_id];
+    if (std::any_of(variables.begin(), variables.end(),
+                    [](ProcessVariable const& variable) {
+                        return !variable.getDeactivatedSubdomains().empty();
+                    }))
+    {
+        return false;
+    }
+    return isMassMatrixConstantConcreteProcess(process_id);
+}
+
 void Process::constructDofTable()
 {
     if (_use_monolithic_scheme)
@@ -354,6 +383,8 @@ void Process::computeSparsityPattern()
 {
     _sparsity_pattern =
         NumLib::computeSparsityPattern(*_local_to_global_index_map, _mesh);
+    _sparsity_pattern_memory.set(_sparsity_pattern.capacity() *
+                                 sizeof(GlobalSparsityPattern::value_type));
 }
 
 void Process::preTimestep(std::vector<GlobalVector*> const& x, const double t,
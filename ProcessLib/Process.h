@@ -12,6 +12,7 @@
 
 #include <tuple>
 
+#include "BaseLib/MemoryAccounting.h"
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/ODESolver/ODESystem.h"
 #include "NumLib/ODESolver/TimeDiscretization.h"
@@ -74,6 +75,20 @@ public:
     void computeSecondaryVariable(const double t, GlobalVector const& x,
                                   int const process_id);
 
+    /// Declares that the secondary variables are used during the simulation,
+    /// e.g., by another process or a boundary condition, and have to be
+    /// computed after each time step. Otherwise they are only computed for
+    /// the time steps with output.
+    void requireSecondaryVariablesEachTimestep()
+    {
+        _secondary_variables_required_each_timestep = true;
+    }
+
+    bool areSecondaryVariablesRequiredEachTimestep() const
+    {
+        return _secondary_variables_required_each_timestep;
+    }
+
     NumLib::IterationResult postIteration(GlobalVector const& x) final;
 
     void initialize();
@@ -110,6 +125,13 @@ public:
                               GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
                               GlobalMatrix& Jac) final;
 
+    bool isMassMatrixConstant(int const process_id) const final;
+
+    void setMassMatrixAssembly(bool const enabled) final
+    {
+        _global_assembler.setMassMatrixAssembly(enabled);
+    }
+
     std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
     getKnownSolutions(double const t, GlobalVector const& x,
                       int const process_id) const final
@@ -204,6 +226,15 @@ private:
         int const process_id, GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
         GlobalMatrix& Jac) = 0;
 
+    /// Returns true if the mass matrix of the concrete process depends neither
+    /// on time nor on the state. Processes returning true must assemble the
+    /// mass matrix with the process' \c _global_assembler.
+    virtual bool isMassMatrixConstantConcreteProcess(
+        int const /*process_id*/) const
+    {
+        return false;
+    }
+
     virtual void preTimestepConcreteProcess(
         std::vector<GlobalVector*> const& /*x*/,
         const double /*t*/,
@@ -317,6 +348,8 @@ protected:
         _integration_point_writer;
 
     GlobalSparsityPattern _sparsity_pattern;
+    BaseLib::TrackedMemory _sparsity_pattern_memory{
+        BaseLib::MemoryTag::SparsityPattern};
 
 protected:
     /// Variables used by this process.  For the monolithic scheme or a
@@ -338,6 +371,8 @@ private:
     std::vector<SourceTermCollection> _source_term_collections;
 
     ExtrapolatorData _extrapolator_data;
+
+    bool _secondary_variables_required_each_timestep = false;
 };
 
 }  // namespace ProcessLib
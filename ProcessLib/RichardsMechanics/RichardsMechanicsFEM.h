@@ -23,6 +23,7 @@
 #include "ProcessLib/Deformation/LinearBMatrix.h"
 #include "ProcessLib/LocalAssemblerTraits.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
+#include "ProcessLib/Utils/IntegrationPointDataVector.h"
 
 #include "IntegrationPointData.h"
 #include "LocalAssemblerInterface.h"
@@ -259,7 +260,7 @@ private:
         IntegrationPointData<BMatricesType, ShapeMatricesTypeDisplacement,
                              ShapeMatricesTypePressure, DisplacementDim,
                              ShapeFunctionDisplacement::NPOINTS>;
-    std::vector<IpData, Eigen::aligned_allocator<IpData>> _ip_data;
+    IntegrationPointDataVector<IpData> _ip_data;
 
     IntegrationMethod _integration_method;
     MeshLib::Element const& _element;
@@ -15,6 +15,7 @@
 #include "MaterialLib/SolidModels/CreateConstitutiveRelation.h"
 #include "ParameterLib/Utils.h"
 #include "ProcessLib/Output/CreateSecondaryVariables.h"
+#include "ProcessLib/Utils/IntegrationOrders.h"
 #include "ProcessLib/Utils/ProcessUtils.h"
 
 #include "SmallDeformationProcess.h"
@@ -114,7 +115,8 @@ std::unique_ptr<Process> createSmallDeformationProcess(
     SmallDeformationProcessData<DisplacementDim> process_data{
         materialIDs(mesh),   std::move(solid_constitutive_relations),
         initial_stress,      solid_density,
-        specific_body_force, reference_temperature};
+        specific_body_force, reference_temperature,
+        createIntegrationOrdersPerMaterial(config)};
 
     SecondaryVariableCollection secondary_variables;
 
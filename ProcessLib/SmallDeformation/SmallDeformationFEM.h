@@ -26,6 +26,8 @@
 #include "ProcessLib/LocalAssemblerInterface.h"
 #include "ProcessLib/LocalAssemblerTraits.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
+#include "ProcessLib/Utils/IntegrationPointDataVector.h"
+#include "ProcessLib/Utils/IntegrationOrders.h"
 
 #include "LocalAssemblerInterface.h"
 #include "SmallDeformationProcessData.h"
@@ -112,7 +114,9 @@ public:
         unsigned const integration_order,
         SmallDeformationProcessData<DisplacementDim>& process_data)
         : _process_data(process_data),
-          _integration_method(integration_order),
+          _integration_method(getIntegrationOrder(
+              process_data.integration_orders_per_material,
+              process_data.material_ids, e.getID(), integration_order)),
           _element(e),
           _is_axially_symmetric(is_axially_symmetric)
     {
@@ -495,10 +499,8 @@ public:
 private:
     SmallDeformationProcessData<DisplacementDim>& _process_data;
 
-    std::vector<
-        IntegrationPointData<BMatricesType, ShapeMatricesType, DisplacementDim>,
-        Eigen::aligned_allocator<IntegrationPointData<
-            BMatricesType, ShapeMatricesType, DisplacementDim>>>
+    IntegrationPointDataVector<
+        IntegrationPointData<BMatricesType, ShapeMatricesType, DisplacementDim>>
         _ip_data;
 
     IntegrationMethod _integration_method;
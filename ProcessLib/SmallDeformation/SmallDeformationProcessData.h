@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <utility>
 
@@ -53,6 +54,10 @@ struct SmallDeformationProcessData
 
     double const reference_temperature =
         std::numeric_limits<double>::quiet_NaN();
+
+    /// Integration orders deviating from the process' integration order for
+    /// the elements of single material ids.
+    std::map<int, unsigned> const integration_orders_per_material;
 };
 
 }  // namespace SmallDeformation
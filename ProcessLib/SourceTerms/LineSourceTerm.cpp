@@ -10,6 +10,7 @@
 
 #include "LineSourceTerm.h"
 
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
 namespace ProcessLib
@@ -35,7 +36,7 @@ void LineSourceTerm::integrate(const double t, GlobalVector const& /*x*/,
     DBUG("Assemble LineSourceTerm.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberOnDereferenced(
+    NumLib::ParallelExecutor::executeMemberOnDereferenced(
         &LineSourceTermLocalAssemblerInterface::integrate, _local_assemblers,
         *_source_term_dof_table, t, b);
 }
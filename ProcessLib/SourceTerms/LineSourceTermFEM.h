@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 #include "ParameterLib/Parameter.h"
@@ -94,7 +95,9 @@ public:
             _local_rhs.noalias() += st_val * _ip_data[ip];
         }
         auto const indices = NumLib::getIndices(id, source_term_dof_table);
-        b.add(indices, _local_rhs);
+        NumLib::ParallelExecutor::executeExclusively([&]() {
+            b.add(indices, _local_rhs);
+        });
     }
 
 private:
@@ -10,6 +10,7 @@
 
 #include "VolumetricSourceTerm.h"
 
+#include "NumLib/Assembler/ParallelExecutor.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
 namespace ProcessLib
@@ -36,7 +37,7 @@ void VolumetricSourceTerm::integrate(const double t, GlobalVector const& /*x*/,
     DBUG("Assemble VolumetricSourceTerm.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberOnDereferenced(
+    NumLib::ParallelExecutor::executeMemberOnDereferenced(
         &VolumetricSourceTermLocalAssemblerInterface::integrate,
         _local_assemblers, *_source_term_dof_table, t, b);
 }
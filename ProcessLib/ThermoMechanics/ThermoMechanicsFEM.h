@@ -23,6 +23,7 @@
 #include "ProcessLib/Deformation/BMatrixPolicy.h"
 #include "ProcessLib/Deformation/LinearBMatrix.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
+#include "ProcessLib/Utils/IntegrationPointDataVector.h"
 
 #include "LocalAssemblerInterface.h"
 #include "ThermoMechanicsProcessData.h"
@@ -310,10 +311,8 @@ private:
 
     ThermoMechanicsProcessData<DisplacementDim>& _process_data;
 
-    std::vector<
-        IntegrationPointData<BMatricesType, ShapeMatricesType, DisplacementDim>,
-        Eigen::aligned_allocator<IntegrationPointData<
-            BMatricesType, ShapeMatricesType, DisplacementDim>>>
+    IntegrationPointDataVector<
+        IntegrationPointData<BMatricesType, ShapeMatricesType, DisplacementDim>>
         _ip_data;
 
     IntegrationMethod _integration_method;
@@ -11,10 +11,12 @@
 #include "TimeLoop.h"
 
 #include "BaseLib/Error.h"
+#include "BaseLib/EventTracer.h"
 #include "BaseLib/RunTime.h"
 #include "ChemistryLib/ChemicalSolverInterface.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
+#include "NumLib/ODESolver/FixedPointAcceleration.h"
 #include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
 #include "ProcessLib/CreateProcessData.h"
 #include "ProcessLib/Output/CreateOutput.h"
@@ -221,6 +223,13 @@ NumLib::NonlinearSolverStatus solveOneTimeStepOneProcess(
                 process, process_id, timestep, t, x, iteration);
         };
 
+#ifdef USE_PETSC
+    // A reused preconditioner is rebuilt if the time step size changes.
+    nonlinear_solver.getLinearSolver().setTimeStepSize(delta_t);
+#endif
+
+    BaseLib::TraceScope const trace_nonlinear_solver("nonlinear solver",
+                                                     "ProcessLib");
     auto const nonlinear_solver_status =
         nonlinear_solver.solve(x, post_iteration_callback, process_id);
 
@@ -238,6 +247,8 @@ TimeLoop::TimeLoop(
     const int global_coupling_max_iterations,
     std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
         global_coupling_conv_crit,
+    std::vector<std::unique_ptr<NumLib::FixedPointAcceleration>>&&
+        global_coupling_accelerations,
     std::unique_ptr<ChemistryLib::ChemicalSolverInterface>&& chemical_system,
     const double start_time, const double end_time)
     : _output(std::move(output)),
@@ -246,7 +257,12 @@ TimeLoop::TimeLoop(
       _end_time(end_time),
       _global_coupling_max_iterations(global_coupling_max_iterations),
       _global_coupling_conv_crit(std::move(global_coupling_conv_crit)),
-      _chemical_system(std::move(chemical_system))
+      _global_coupling_accelerations(std::move(global_coupling_accelerations)),
+      _chemical_system(std::move(chemical_system)),
+      _outdated_secondary_variables(
+          [this](double const t, int const process_id) {
+              computeSecondaryVariables(t, process_id);
+          })
 {
 }
 
@@ -435,6 +451,7 @@ void TimeLoop::initialize()
     {
         BaseLib::RunTime time_phreeqc;
         time_phreeqc.start();
+        BaseLib::TraceScope const trace_chemistry("chemistry", "ChemistryLib");
         _chemical_system->executeInitialCalculation(_process_solutions);
         INFO("[time] Phreeqc took %g s.", time_phreeqc.elapsed());
     }
@@ -481,6 +498,7 @@ bool TimeLoop::loop()
 
     while (t < _end_time)
     {
+        BaseLib::TraceScope const trace_timestep("time step", "ProcessLib");
         BaseLib::RunTime time_timestep;
         time_timestep.start();
 
@@ -524,6 +542,16 @@ bool TimeLoop::loop()
 
         if (!_last_step_rejected)
         {
+#ifdef USE_INSITU
+            // The in-situ adaptor is called for every time step.
+            bool const is_output_step = true;
+#else
+            bool const is_output_step = _output->isOutputStep(timesteps, t);
+#endif
+            if (is_output_step)
+            {
+                _outdated_secondary_variables.computeOutdated(t);
+            }
             const bool output_initial_condition = false;
             outputSolutions(output_initial_condition, timesteps, t, *_output,
                             &Output::doOutput);
@@ -553,6 +581,11 @@ bool TimeLoop::loop()
     // output last time step
     if (nonlinear_solver_status.error_norms_met)
     {
+        // The last time step is written, if it has not been written yet.
+        if (!_output->isOutputStep(accepted_steps + rejected_steps, t))
+        {
+            _outdated_secondary_variables.computeOutdated(t);
+        }
         const bool output_initial_condition = false;
         outputSolutions(output_initial_condition,
                         accepted_steps + rejected_steps, t, *_output,
@@ -598,7 +631,8 @@ static constexpr std::string_view timestepper_cannot_reduce_dt =
 void postTimestepForAllProcesses(
     double const t, double const dt,
     std::vector<std::unique_ptr<ProcessData>> const& per_process_data,
-    std::vector<GlobalVector*> const& process_solutions)
+    std::vector<GlobalVector*> const& process_solutions,
+    OutdatedSecondaryVariables& outdated_secondary_variables)
 {
     // All _per_process_data share the first process.
     bool const is_staggered_coupling =
@@ -617,7 +651,15 @@ void postTimestepForAllProcesses(
         }
         auto& x = *process_solutions[process_id];
         pcs.postTimestep(process_solutions, t, dt, process_id);
-        pcs.computeSecondaryVariable(t, x, process_id);
+        if (pcs.areSecondaryVariablesRequiredEachTimestep())
+        {
+            pcs.computeSecondaryVariable(t, x, process_id);
+        }
+        else
+        {
+            // Deferred until output is written.
+            outdated_secondary_variables.markOutdated(process_id);
+        }
     }
 }
 
@@ -643,6 +685,8 @@ NumLib::NonlinearSolverStatus TimeLoop::solveUncoupledEquationSystems(
             if (!process_data->timestepper->canReduceTimestepSize())
             {
                 // save unsuccessful solution
+                _outdated_secondary_variables.markOutdated(process_id);
+                _outdated_secondary_variables.computeOutdated(t);
                 _output->doOutputAlways(process_data->process, process_id,
                                         timestep_id, t, _process_solutions);
                 OGS_FATAL(timestepper_cannot_reduce_dt.data());
@@ -652,7 +696,8 @@ NumLib::NonlinearSolverStatus TimeLoop::solveUncoupledEquationSystems(
         }
     }
 
-    postTimestepForAllProcesses(t, dt, _per_process_data, _process_solutions);
+    postTimestepForAllProcesses(t, dt, _per_process_data, _process_solutions,
+                                _outdated_secondary_variables);
 
     return nonlinear_solver_status;
 }
@@ -677,6 +722,12 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
         }
     };
 
+    // The history of the previous time step is not related to this one.
+    for (auto& acceleration : _global_coupling_accelerations)
+    {
+        acceleration->reset();
+    }
+
     preTimestepForAllProcesses(t, dt, _per_process_data, _process_solutions);
 
     NumLib::NonlinearSolverStatus nonlinear_solver_status{false, -1};
@@ -685,6 +736,8 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
          global_coupling_iteration < _global_coupling_max_iterations;
          global_coupling_iteration++, resetCouplingConvergenceCriteria())
     {
+        BaseLib::TraceScope const trace_coupling_iteration(
+            "coupling iteration", "ProcessLib");
         // TODO(wenqing): use process name
         coupling_iteration_converged = true;
         int const last_process_id = _per_process_data.size() - 1;
@@ -720,6 +773,8 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                 if (!process_data->timestepper->canReduceTimestepSize())
                 {
                     // save unsuccessful solution
+                    _outdated_secondary_variables.markOutdated(process_id);
+                    _outdated_secondary_variables.computeOutdated(t);
                     _output->doOutputAlways(process_data->process, process_id,
                                             timestep_id, t, _process_solutions);
                     OGS_FATAL(timestepper_cannot_reduce_dt.data());
@@ -745,9 +800,29 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                         _global_coupling_conv_crit[process_id]->isSatisfied();
                 }
             }
-            MathLib::LinAlg::copy(x, x_old);
         }  // end of for (auto& process_data : _per_process_data)
 
+        if (nonlinear_solver_status.error_norms_met)
+        {
+            // The convergence is checked on the unaccelerated update, the
+            // accelerated solution is the input of the next iteration. A
+            // converged solution is accepted without acceleration.
+            if (global_coupling_iteration > 0)
+            {
+                NumLib::accelerateUnlessConverged(
+                    coupling_iteration_converged,
+                    _global_coupling_accelerations, _process_solutions,
+                    _solutions_of_last_cpl_iteration);
+            }
+            for (auto& process_data : _per_process_data)
+            {
+                auto const process_id = process_data->process_id;
+                MathLib::LinAlg::copy(
+                    *_process_solutions[process_id],
+                    *_solutions_of_last_cpl_iteration[process_id]);
+            }
+        }
+
         if (coupling_iteration_converged && global_coupling_iteration > 0)
         {
             break;
@@ -776,15 +851,35 @@ TimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
         // space and localized chemical equilibrium between solutes.
         BaseLib::RunTime time_phreeqc;
         time_phreeqc.start();
+        BaseLib::TraceScope const trace_chemistry("chemistry", "ChemistryLib");
         _chemical_system->doWaterChemistryCalculation(_process_solutions, dt);
         INFO("[time] Phreeqc took %g s.", time_phreeqc.elapsed());
     }
 
-    postTimestepForAllProcesses(t, dt, _per_process_data, _process_solutions);
+    postTimestepForAllProcesses(t, dt, _per_process_data, _process_solutions,
+                                _outdated_secondary_variables);
 
     return nonlinear_solver_status;
 }
 
+void TimeLoop::computeSecondaryVariables(const double t,
+                                         int const process_id)
+{
+    // All _per_process_data share the first process.
+    bool const is_staggered_coupling =
+        !isMonolithicProcess(*_per_process_data[0]);
+
+    auto& pcs = _per_process_data[process_id]->process;
+
+    CoupledSolutionsForStaggeredScheme coupled_solutions(_process_solutions);
+    if (is_staggered_coupling)
+    {
+        pcs.setCoupledSolutionsForStaggeredScheme(&coupled_solutions);
+    }
+    pcs.computeSecondaryVariable(t, *_process_solutions[process_id],
+                                 process_id);
+}
+
 template <typename OutputClass, typename OutputClassMember>
 void TimeLoop::outputSolutions(bool const output_initial_condition,
                                unsigned timestep, const double t,
@@ -828,6 +923,7 @@ void TimeLoop::outputSolutions(bool const output_initial_condition,
                 .setCoupledTermForTheStaggeredSchemeToLocalAssemblers(
                     process_id);
         }
+        BaseLib::TraceScope const trace_output("output", "ProcessLib");
         (output_object.*output_class_member)(pcs, process_id, timestep, t,
                                              _process_solutions);
     }
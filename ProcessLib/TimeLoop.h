@@ -19,11 +19,13 @@
 #include "NumLib/TimeStepping/Algorithms/TimeStepAlgorithm.h"
 #include "ProcessLib/Output/Output.h"
 
+#include "OutdatedSecondaryVariables.h"
 #include "Process.h"
 
 namespace NumLib
 {
 class ConvergenceCriterion;
+class FixedPointAcceleration;
 }
 
 namespace ChemistryLib
@@ -44,6 +46,8 @@ public:
              const int global_coupling_max_iterations,
              std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>&&
                  global_coupling_conv_crit,
+             std::vector<std::unique_ptr<NumLib::FixedPointAcceleration>>&&
+                 global_coupling_accelerations,
              std::unique_ptr<ChemistryLib::ChemicalSolverInterface>&&
                  chemical_system,
              const double start_time, const double end_time);
@@ -104,6 +108,10 @@ private:
                                std::size_t& accepted_steps,
                                std::size_t& rejected_steps);
 
+    /// Computes the secondary variables of the given process for its current
+    /// solution.
+    void computeSecondaryVariables(const double t, int const process_id);
+
     template <typename OutputClass, typename OutputClassMember>
     void outputSolutions(bool const output_initial_condition, unsigned timestep,
                          const double t, OutputClass& output_object,
@@ -124,11 +132,20 @@ private:
     /// Convergence criteria of processes for the global coupling iterations.
     std::vector<std::unique_ptr<NumLib::ConvergenceCriterion>>
         _global_coupling_conv_crit;
+    /// Optional accelerations of the global coupling iterations, one per
+    /// process. Empty if the coupling iterations are not accelerated.
+    std::vector<std::unique_ptr<NumLib::FixedPointAcceleration>>
+        _global_coupling_accelerations;
 
     std::unique_ptr<ChemistryLib::ChemicalSolverInterface> _chemical_system;
 
     /// Solutions of the previous coupling iteration for the convergence
     /// criteria of the coupling iteration.
     std::vector<GlobalVector*> _solutions_of_last_cpl_iteration;
+
+    /// Processes, for which the computation of the secondary variables was
+    /// deferred after the last time step, because the variables are only
+    /// needed for output.
+    OutdatedSecondaryVariables _outdated_secondary_variables;
 };
 }  // namespace ProcessLib
@@ -0,0 +1,86 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "IntegrationOrders.h"
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "MeshLib/PropertyVector.h"
+
+namespace ProcessLib
+{
+std::map<int, unsigned> createIntegrationOrdersPerMaterial(
+    BaseLib::ConfigTree const& config)
+{
+    std::map<int, unsigned> integration_orders;
+
+    auto const orders_config =
+        //! \ogs_file_param{prj__processes__process__integration_orders}
+        config.getConfigSubtreeOptional("integration_orders");
+    if (!orders_config)
+    {
+        return integration_orders;
+    }
+
+    for (auto const& order_config :
+         //! \ogs_file_param{prj__processes__process__integration_orders__integration_order}
+         orders_config->getConfigParameterList("integration_order"))
+    {
+        auto const material_id =
+            //! \ogs_file_attr{prj__processes__process__integration_orders__integration_order__material_id}
+            order_config.getConfigAttribute<int>("material_id");
+        auto const order = order_config.getValue<int>();
+        if (order < 1)
+        {
+            OGS_FATAL(
+                "The integration order %d for material id %d must be "
+                "positive.",
+                order, material_id);
+        }
+
+        if (!integration_orders.emplace(material_id, order).second)
+        {
+            OGS_FATAL(
+                "Multiple integration orders were specified for the material "
+                "id %d.",
+                material_id);
+        }
+        INFO("Using integration order %d for material id %d.", order,
+             material_id);
+    }
+
+    return integration_orders;
+}
+
+unsigned getIntegrationOrder(
+    std::map<int, unsigned> const& integration_orders_per_material,
+    MeshLib::PropertyVector<int> const* const material_ids,
+    std::size_t const element_id, unsigned const default_integration_order)
+{
+    if (integration_orders_per_material.empty())
+    {
+        return default_integration_order;
+    }
+    if (material_ids == nullptr)
+    {
+        OGS_FATAL(
+            "Integration orders per material id are given but the mesh has no "
+            "material ids.");
+    }
+
+    auto const it =
+        integration_orders_per_material.find((*material_ids)[element_id]);
+    return it == integration_orders_per_material.end()
+               ? default_integration_order
+               : it->second;
+}
+}  // namespace ProcessLib
@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <map>
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+namespace MeshLib
+{
+template <typename PROP_VAL_TYPE>
+class PropertyVector;
+}
+
+namespace ProcessLib
+{
+/// Reads the optional integration orders overriding the process' integration
+/// order for the elements of single material ids, e.g., a lower order in
+/// linear elastic regions.
+///
+/// \attention The integration point data of elements with different
+/// integration orders cannot be read as initial conditions.
+std::map<int, unsigned> createIntegrationOrdersPerMaterial(
+    BaseLib::ConfigTree const& config);
+
+/// Returns the integration order for the given element: the one configured for
+/// the element's material id, if any, or the \c default_integration_order.
+unsigned getIntegrationOrder(
+    std::map<int, unsigned> const& integration_orders_per_material,
+    MeshLib::PropertyVector<int> const* const material_ids,
+    std::size_t const element_id, unsigned const default_integration_order);
+}  // namespace ProcessLib
@@ -0,0 +1,29 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "BaseLib/MemoryAccounting.h"
+
+namespace ProcessLib
+{
+/// Storage of the integration point data of a local assembler. The memory is
+/// accounted to BaseLib::MemoryTag::IntegrationPointData.
+template <typename IpData>
+using IntegrationPointDataVector =
+    std::vector<IpData,
+                BaseLib::CountingAllocator<
+                    IpData, BaseLib::MemoryTag::IntegrationPointData,
+                    Eigen::aligned_allocator<IpData>>>;
+}  // namespace ProcessLib
@@ -88,7 +88,7 @@ void VectorMatrixAssembler::assemble(
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
+    if (_assemble_mass_matrix && !_local_M_data.empty())
     {
         auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
         M.add(r_c_indices, local_M);
@@ -160,7 +160,7 @@ void VectorMatrixAssembler::assembleWithJacobian(
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
+    if (_assemble_mass_matrix && !_local_M_data.empty())
     {
         auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
         M.add(r_c_indices, local_M);
@@ -66,6 +66,14 @@ public:
         GlobalMatrix& Jac,
         CoupledSolutionsForStaggeredScheme const* const cpl_xs);
 
+    //! If disabled, the local mass matrices are not added to the global
+    //! matrix \c M in assemble() and assembleWithJacobian(), which is then
+    //! left untouched. This is used to reuse a constant mass matrix.
+    void setMassMatrixAssembly(bool const enabled)
+    {
+        _assemble_mass_matrix = enabled;
+    }
+
 private:
     // temporary data only stored here in order to avoid frequent memory
     // reallocations.
@@ -76,6 +84,8 @@ private:
 
     //! Used to assemble the Jacobian.
     std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
+
+    bool _assemble_mass_matrix = true;
 };
 
 }  // namespace ProcessLib
@@ -0,0 +1,104 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Applications/Utils/ModelPreparation/PartitionMesh/ElementWeights.h"
+#include "InfoLib/TestInfo.h"
+
+TEST(ApplicationUtilsElementWeights, ScaledToMostExpensiveElement)
+{
+    // The weights range from 1 to 100; zero costs get the minimal weight.
+    EXPECT_EQ((std::vector<long>{1, 25, 50, 100, 1}),
+              ApplicationUtils::computeMetisElementWeights(
+                  {0.0, 1.0, 2.0, 4.0, 1e-3}));
+
+    // Only the ratios of the costs matter.
+    EXPECT_EQ((std::vector<long>{10, 100}),
+              ApplicationUtils::computeMetisElementWeights({2e-7, 2e-6}));
+
+    EXPECT_TRUE(ApplicationUtils::computeMetisElementWeights({}).empty());
+}
+
+TEST(ApplicationUtilsElementWeights, InvalidCosts)
+{
+    EXPECT_ANY_THROW(ApplicationUtils::computeMetisElementWeights({1.0, -1.0}));
+    EXPECT_ANY_THROW(ApplicationUtils::computeMetisElementWeights(
+        {1.0, std::numeric_limits<double>::quiet_NaN()}));
+    EXPECT_ANY_THROW(ApplicationUtils::computeMetisElementWeights(
+        {1.0, std::numeric_limits<double>::infinity()}));
+    EXPECT_ANY_THROW(ApplicationUtils::computeMetisElementWeights({0.0, 0.0}));
+}
+
+class ApplicationUtilsElementCostProfile : public ::testing::Test
+{
+public:
+    ApplicationUtilsElementCostProfile()
+        : _file_name(TestInfoLib::TestInfo::tests_tmp_path +
+                     "element_cost_profile.txt")
+    {
+    }
+
+    ~ApplicationUtilsElementCostProfile() override
+    {
+        std::remove(_file_name.c_str());
+    }
+
+protected:
+    void writeProfile(std::string const& content) const
+    {
+        std::ofstream out(_file_name);
+        out << content;
+    }
+
+    std::string const _file_name;
+};
+
+TEST_F(ApplicationUtilsElementCostProfile, Read)
+{
+    writeProfile(
+        "# element_id cost\n"
+        "2 0.5\n"
+        "\n"
+        "  0 1.5\n"
+        "1 2\r\n");
+    EXPECT_EQ((std::vector<double>{1.5, 2.0, 0.5}),
+              ApplicationUtils::readElementCostProfile(_file_name, 3));
+}
+
+TEST_F(ApplicationUtilsElementCostProfile, MissingFile)
+{
+    EXPECT_ANY_THROW(ApplicationUtils::readElementCostProfile(
+        _file_name + ".does_not_exist", 1));
+}
+
+TEST_F(ApplicationUtilsElementCostProfile, MalformedLine)
+{
+    writeProfile("0 1.0\n1 expensive\n");
+    EXPECT_ANY_THROW(ApplicationUtils::readElementCostProfile(_file_name, 2));
+}
+
+TEST_F(ApplicationUtilsElementCostProfile, ElementIdOutOfRange)
+{
+    writeProfile("0 1.0\n1 1.0\n2 1.0\n");
+    EXPECT_ANY_THROW(ApplicationUtils::readElementCostProfile(_file_name, 2));
+}
+
+TEST_F(ApplicationUtilsElementCostProfile, MissingElement)
+{
+    writeProfile("0 1.0\n2 1.0\n");
+    EXPECT_ANY_THROW(ApplicationUtils::readElementCostProfile(_file_name, 3));
+}
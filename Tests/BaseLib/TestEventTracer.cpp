@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <cstdio>
+#include <map>
+#include <string>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <gtest/gtest.h>
+
+#include "BaseLib/EventTracer.h"
+#include "InfoLib/TestInfo.h"
+
+TEST(BaseLibEventTracer, WriteChromeTrace)
+{
+    ASSERT_FALSE(BaseLib::EventTracer::isEnabled());
+    {
+        // Not recorded.
+        BaseLib::TraceScope const scope("disabled", "test");
+    }
+
+    BaseLib::EventTracer::enable();
+    {
+        BaseLib::TraceScope const outer("outer", "test");
+        int const n = 8;
+#pragma omp parallel for
+        for (int i = 0; i < n; ++i)
+        {
+            BaseLib::TraceScope const inner("inner", "test");
+        }
+    }
+    std::string const file_name =
+        TestInfoLib::TestInfo::tests_tmp_path + "EventTracer.json";
+    BaseLib::EventTracer::writeChromeTrace(file_name);
+    BaseLib::EventTracer::disable();
+    ASSERT_FALSE(BaseLib::EventTracer::isEnabled());
+
+    boost::property_tree::ptree trace;
+    boost::property_tree::read_json(file_name, trace);
+    std::remove(file_name.c_str());
+
+    std::map<std::string, int> counts;
+    for (auto const& item : trace.get_child("traceEvents"))
+    {
+        auto const& event = item.second;
+        if (event.get<std::string>("ph") != "X")
+        {
+            continue;
+        }
+        EXPECT_EQ("test", event.get<std::string>("cat"));
+        EXPECT_EQ(0, event.get<int>("pid"));
+        EXPECT_LE(0, event.get<double>("ts"));
+        EXPECT_LE(0, event.get<double>("dur"));
+        ++counts[event.get<std::string>("name")];
+    }
+    EXPECT_EQ(0, counts["disabled"]);
+    EXPECT_EQ(1, counts["outer"]);
+    EXPECT_EQ(8, counts["inner"]);
+}
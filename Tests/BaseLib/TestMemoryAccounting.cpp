@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/MemoryAccounting.h"
+
+namespace
+{
+std::size_t usage(BaseLib::MemoryTag const tag)
+{
+    return BaseLib::MemoryAccounting::getCurrentUsage()
+        [static_cast<std::size_t>(tag)];
+}
+}  // namespace
+
+TEST(BaseLibMemoryAccounting, TrackedMemory)
+{
+    auto const tag = BaseLib::MemoryTag::Factorizations;
+    auto const initial = usage(tag);
+    {
+        BaseLib::TrackedMemory memory(tag);
+        memory.set(1000);
+        EXPECT_EQ(initial + 1000, usage(tag));
+
+        memory.set(400);
+        EXPECT_EQ(initial + 400, usage(tag));
+
+        BaseLib::TrackedMemory const copy(memory);
+        EXPECT_EQ(initial + 800, usage(tag));
+
+        BaseLib::TrackedMemory const moved(std::move(memory));
+        EXPECT_EQ(0u, memory.bytes());  // NOLINT(bugprone-use-after-move)
+        EXPECT_EQ(initial + 800, usage(tag));
+    }
+    EXPECT_EQ(initial, usage(tag));
+}
+
+TEST(BaseLibMemoryAccounting, CountingAllocator)
+{
+    auto const tag = BaseLib::MemoryTag::IntegrationPointData;
+    auto const initial = usage(tag);
+    {
+        std::vector<double, BaseLib::CountingAllocator<double, tag>> v;
+        v.reserve(100);
+        EXPECT_EQ(initial + 100 * sizeof(double), usage(tag));
+
+        auto const w = v;
+        EXPECT_EQ(initial + (100 + w.capacity()) * sizeof(double), usage(tag));
+    }
+    EXPECT_EQ(initial, usage(tag));
+}
+
+TEST(BaseLibMemoryAccounting, PeakUsage)
+{
+    auto const tag = BaseLib::MemoryTag::OutputBuffers;
+    auto const index = static_cast<std::size_t>(tag);
+
+    std::size_t const large = std::size_t{1} << 40;
+    {
+        BaseLib::TrackedMemory memory(tag);
+        memory.set(large);
+    }
+    // The peak is taken at the maximum of the total usage, which is reached
+    // with the large allocation.
+    EXPECT_LE(large, BaseLib::MemoryAccounting::getPeakUsage()[index]);
+    EXPECT_GT(large, BaseLib::MemoryAccounting::getCurrentUsage()[index]);
+}
@@ -0,0 +1,64 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "MathLib/DualNumber.h"
+
+using Dual = MathLib::DualNumber<2>;
+
+// f(x, y) = exp(x) * log(y) / sqrt(x * y) + pow(x, 3) - 2 / y
+template <typename T>
+T f(T const& x, T const& y)
+{
+    using std::exp;
+    using std::log;
+    using std::pow;
+    using std::sqrt;
+    return exp(x) * log(y) / sqrt(x * y) + pow(x, 3.0) - 2.0 / y;
+}
+
+TEST(MathLibDualNumber, ChainRule)
+{
+    double const x = 0.7;
+    double const y = 1.9;
+
+    auto const result =
+        f(Dual::variable(x, 0), Dual::variable(y, 1));
+
+    ASSERT_NEAR(f(x, y), result.value(), 1e-15);
+
+    double const s = std::sqrt(x * y);
+    double const df_dx = std::exp(x) * std::log(y) / s *
+                             (1.0 - 0.5 / x) +
+                         3.0 * x * x;
+    double const df_dy = std::exp(x) / s * (1.0 / y - 0.5 * std::log(y) / y) +
+                         2.0 / (y * y);
+    EXPECT_NEAR(df_dx, result.derivatives()[0], 1e-13);
+    EXPECT_NEAR(df_dy, result.derivatives()[1], 1e-13);
+}
+
+TEST(MathLibDualNumber, EigenExpressions)
+{
+    Eigen::Matrix2d const A = (Eigen::Matrix2d() << 1, 2, 3, 4).finished();
+    Eigen::Matrix<Dual, 2, 1> v;
+    v[0] = Dual::variable(5.0, 0);
+    v[1] = Dual::variable(6.0, 1);
+
+    // The Jacobian of A v is A.
+    Eigen::Matrix<Dual, 2, 1> const w = A.cast<Dual>() * v;
+    for (int i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(A(i, 0) * 5.0 + A(i, 1) * 6.0, w[i].value());
+        EXPECT_EQ(A(i, 0), w[i].derivatives()[0]);
+        EXPECT_EQ(A(i, 1), w[i].derivatives()[1]);
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Eigen/IterativeLinearSolvers>
+
+#include "MathLib/LinAlg/Eigen/EigenGCRODR.h"
+
+namespace
+{
+using SparseMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+using Solver =
+    MathLib::EigenGCRODR<SparseMatrix, Eigen::IdentityPreconditioner>;
+
+// Poorly conditioned 1D Laplacian, slightly perturbed by the shift.
+SparseMatrix createLaplacian(int const n, double const shift)
+{
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; ++i)
+    {
+        triplets.emplace_back(i, i, 2.0 + shift);
+        if (i > 0)
+        {
+            triplets.emplace_back(i, i - 1, -1.0);
+        }
+        if (i < n - 1)
+        {
+            triplets.emplace_back(i, i + 1, -1.0);
+        }
+    }
+    SparseMatrix A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    A.makeCompressed();
+    return A;
+}
+
+Eigen::Index solve(Solver& solver, SparseMatrix const& A,
+                   Eigen::VectorXd const& b)
+{
+    solver.compute(A);
+    Eigen::VectorXd const x =
+        solver.solveWithGuess(b, Eigen::VectorXd::Zero(A.rows()));
+    EXPECT_EQ(Eigen::Success, solver.info());
+    EXPECT_LE((b - A * x).norm(), 1.01e-10 * b.norm());
+    return solver.iterations();
+}
+}  // namespace
+
+TEST(MathLibEigen, GCRODRRecyclingReducesIterations)
+{
+    int const n = 300;
+    Solver gcrodr;
+    Solver gmres;
+    for (auto* solver : {&gcrodr, &gmres})
+    {
+        solver->setTolerance(1e-10);
+        solver->setMaxIterations(100000);
+        solver->setRestart(30);
+    }
+    gcrodr.setRecycledSubspaceSize(10);
+    gmres.setRecycledSubspaceSize(0);
+
+    Eigen::Index gcrodr_iterations = 0;
+    Eigen::Index gmres_iterations = 0;
+    for (int step = 0; step < 4; ++step)
+    {
+        auto const A = createLaplacian(n, 1e-4 * step);
+        Eigen::VectorXd const b =
+            Eigen::VectorXd::LinSpaced(n, -1.0, 1.0 + step);
+        gcrodr_iterations += solve(gcrodr, A, b);
+        gmres_iterations += solve(gmres, A, b);
+    }
+
+    EXPECT_EQ(10, gcrodr.recycledSubspaceSize());
+    EXPECT_EQ(0, gmres.recycledSubspaceSize());
+    EXPECT_LT(2 * gcrodr_iterations, gmres_iterations);
+}
+
+TEST(MathLibEigen, GCRODRDropsSubspaceOfOtherSize)
+{
+    Solver solver;
+    solver.setTolerance(1e-10);
+    solver.setMaxIterations(100000);
+    solver.setRestart(20);
+    solver.setRecycledSubspaceSize(5);
+
+    auto const A = createLaplacian(100, 0);
+    solve(solver, A, Eigen::VectorXd::Ones(100));
+    ASSERT_EQ(5, solver.recycledSubspaceSize());
+
+    auto const B = createLaplacian(50, 0);
+    solver.compute(B);
+    EXPECT_EQ(0, solver.recycledSubspaceSize());
+    solve(solver, B, Eigen::VectorXd::Ones(50));
+}
@@ -0,0 +1,91 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "MathLib/LinAlg/Eigen/EigenSparseMatrixVectorProduct.h"
+
+namespace
+{
+using SparseMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+// Rows of very different lengths, such that a partitioning by the number of
+// rows would be badly balanced.
+SparseMatrix createIrregularMatrix(int const n)
+{
+    std::mt19937 random_number_generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int row = 0; row < n; ++row)
+    {
+        int const row_length = row % 10 == 0 ? n / 2 : 3;
+        for (int k = 0; k < row_length; ++k)
+        {
+            triplets.emplace_back(row, (row + 7 * k) % n,
+                                  distribution(random_number_generator));
+        }
+    }
+    SparseMatrix A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    A.makeCompressed();
+    return A;
+}
+}  // namespace
+
+TEST(MathLibEigen, PartitionRowsByNonZeros)
+{
+    auto const A = createIrregularMatrix(1000);
+    int const number_of_parts = 8;
+    auto const boundaries = MathLib::partitionRowsByNonZeros(
+        A.outerIndexPtr(), static_cast<int>(A.rows()), number_of_parts);
+
+    ASSERT_EQ(number_of_parts + 1, static_cast<int>(boundaries.size()));
+    EXPECT_EQ(0, boundaries.front());
+    EXPECT_EQ(A.rows(), boundaries.back());
+
+    // Each part holds about an equal share of the non-zero entries. Both of
+    // its boundaries may deviate by up to the length of the longest row.
+    int const max_row_length = 500;
+    for (int part = 0; part < number_of_parts; ++part)
+    {
+        EXPECT_LE(boundaries[part], boundaries[part + 1]);
+        auto const nonzeros = A.outerIndexPtr()[boundaries[part + 1]] -
+                              A.outerIndexPtr()[boundaries[part]];
+        EXPECT_NEAR(A.nonZeros() / number_of_parts, nonzeros,
+                    2 * max_row_length);
+    }
+}
+
+TEST(MathLibEigen, SparseMatrixVectorProduct)
+{
+    // Large enough for the parallel code path.
+    auto const A = createIrregularMatrix(2000);
+    ASSERT_GE(A.nonZeros(), MathLib::details::min_nonzeros_for_parallel_spmv);
+
+    Eigen::VectorXd const x = Eigen::VectorXd::LinSpaced(A.cols(), -1.0, 2.0);
+    Eigen::VectorXd const z = Eigen::VectorXd::Constant(A.rows(), 0.5);
+    Eigen::VectorXd const expected = A * x;
+
+    Eigen::VectorXd y;
+    MathLib::sparseMatrixVectorProduct(A, x, nullptr, y);
+    ASSERT_EQ(A.rows(), y.size());
+    EXPECT_TRUE(expected.isApprox(y, 1e-14));
+
+    MathLib::sparseMatrixVectorProduct(A, x, &z, y);
+    EXPECT_TRUE((expected + z).isApprox(y, 1e-14));
+
+    // In place update y = A x + y.
+    y = z;
+    MathLib::sparseMatrixVectorProduct(A, x, &y, y);
+    EXPECT_TRUE((expected + z).isApprox(y, 1e-14));
+}
@@ -241,6 +241,166 @@ TEST(Math, CheckInterface_Eigen)
 }
 #endif
 
+#ifdef OGS_USE_EIGEN
+TEST(Math, CheckInterface_Eigen_SparseLU)
+{
+    // The matrix is symmetric positive definite, hence it is factorized by
+    // Cholesky.
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    t_solver.put("use_cholesky", true);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "",
+        BaseLib::ConfigTree::onerror, BaseLib::ConfigTree::onwarning);
+
+    using IntType = MathLib::EigenMatrix::IndexType;
+
+    MathLib::EigenMatrix A(Example1<IntType>::dim_eqs);
+    checkLinearSolverInterface<MathLib::EigenMatrix, MathLib::EigenVector,
+                               MathLib::EigenLinearSolver, IntType>(A, conf);
+}
+#endif
+
+#ifdef OGS_USE_EIGEN
+TEST(Math, Eigen_SparseLU_CholeskyOrLUFactorization)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    t_solver.put("use_cholesky", true);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "",
+        BaseLib::ConfigTree::onerror, BaseLib::ConfigTree::onwarning);
+
+    // Symmetric positive definite tridiagonal matrix.
+    MathLib::EigenMatrix A(3);
+    A.setValue(0, 0, 2);
+    A.setValue(0, 1, -1);
+    A.setValue(1, 0, -1);
+    A.setValue(1, 1, 2);
+    A.setValue(1, 2, -1);
+    A.setValue(2, 1, -1);
+    A.setValue(2, 2, 2);
+    MathLib::finalizeMatrixAssembly(A);
+
+    // b = A (1, 2, 3)^T
+    MathLib::EigenVector b(3);
+    b.set(0, 0);
+    b.set(1, 0);
+    b.set(2, 4);
+    MathLib::EigenVector x(3);
+
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+    ASSERT_TRUE(ls.solve(A, b, x));
+    EXPECT_EQ("SimplicialLDLT", ls.getLastFactorization());
+    EXPECT_NEAR(1.0, x[0], 1e-12);
+    EXPECT_NEAR(2.0, x[1], 1e-12);
+    EXPECT_NEAR(3.0, x[2], 1e-12);
+
+    // Symmetric indefinite matrix with the same sparsity pattern, the
+    // Cholesky decomposition fails and SparseLU is used instead.
+    A.setValue(1, 1, -2);
+    b.set(1, -8);
+    x.setZero();
+    ASSERT_TRUE(ls.solve(A, b, x));
+    EXPECT_EQ("SparseLU", ls.getLastFactorization());
+    EXPECT_NEAR(1.0, x[0], 1e-12);
+    EXPECT_NEAR(2.0, x[1], 1e-12);
+    EXPECT_NEAR(3.0, x[2], 1e-12);
+
+    // For the same sparsity pattern the Cholesky decomposition is not tried
+    // again, even for a positive definite matrix.
+    A.setValue(1, 1, 2);
+    b.set(1, 0);
+    x.setZero();
+    ASSERT_TRUE(ls.solve(A, b, x));
+    EXPECT_EQ("SparseLU", ls.getLastFactorization());
+    EXPECT_NEAR(2.0, x[1], 1e-12);
+
+    // A new sparsity pattern is tried with Cholesky again.
+    MathLib::EigenMatrix B(3);
+    B.setValue(0, 0, 2);
+    B.setValue(1, 1, 2);
+    B.setValue(2, 2, 2);
+    MathLib::finalizeMatrixAssembly(B);
+    b.set(0, 2);
+    b.set(1, 4);
+    b.set(2, 6);
+    ASSERT_TRUE(ls.solve(B, b, x));
+    EXPECT_EQ("SimplicialLDLT", ls.getLastFactorization());
+    EXPECT_NEAR(2.0, x[1], 1e-12);
+
+    // A badly scaled, slightly non-symmetric matrix is not treated as
+    // symmetric, because the Cholesky decomposition would use the lower
+    // triangle only.
+    MathLib::EigenMatrix C(3);
+    C.setValue(0, 0, 1e8);
+    C.setValue(0, 1, 1);
+    C.setValue(1, 0, 2);
+    C.setValue(1, 1, 1e8);
+    C.setValue(2, 2, 1e8);
+    MathLib::finalizeMatrixAssembly(C);
+    // b = C (1, 2, 3)^T
+    b.set(0, 1e8 + 2);
+    b.set(1, 2e8 + 2);
+    b.set(2, 3e8);
+    x.setZero();
+    ASSERT_TRUE(ls.solve(C, b, x));
+    EXPECT_EQ("SparseLU", ls.getLastFactorization());
+    EXPECT_NEAR(1.0, x[0], 1e-12);
+    EXPECT_NEAR(2.0, x[1], 1e-12);
+    EXPECT_NEAR(3.0, x[2], 1e-12);
+}
+
+TEST(Math, Eigen_SparseLU_CholeskyDisabledByDefault)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "",
+        BaseLib::ConfigTree::onerror, BaseLib::ConfigTree::onwarning);
+
+    MathLib::EigenMatrix A(2);
+    A.setValue(0, 0, 2);
+    A.setValue(1, 1, 2);
+    MathLib::finalizeMatrixAssembly(A);
+    MathLib::EigenVector b(2);
+    b.set(0, 2);
+    b.set(1, 4);
+    MathLib::EigenVector x(2);
+
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+    ASSERT_TRUE(ls.solve(A, b, x));
+    EXPECT_EQ("SparseLU", ls.getLastFactorization());
+    EXPECT_NEAR(2.0, x[1], 1e-12);
+}
+#endif
+
+#ifdef OGS_USE_EIGEN
+TEST(Math, CheckInterface_Eigen_GCRODR)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "GCRODR");
+    t_solver.put("precon_type", "DIAGONAL");
+    t_solver.put("error_tolerance", 1e-15);
+    t_solver.put("max_iteration_step", 1000);
+    t_solver.put("restart", 6);
+    t_solver.put("recycled_subspace_size", 2);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "",
+        BaseLib::ConfigTree::onerror, BaseLib::ConfigTree::onwarning);
+
+    using IntType = MathLib::EigenMatrix::IndexType;
+
+    MathLib::EigenMatrix A(Example1<IntType>::dim_eqs);
+    checkLinearSolverInterface<MathLib::EigenMatrix, MathLib::EigenVector,
+                               MathLib::EigenLinearSolver, IntType>(A, conf);
+}
+#endif
+
 #if defined(OGS_USE_EIGEN) && defined(USE_LIS)
 TEST(Math, CheckInterface_EigenLis)
 {
@@ -363,6 +523,86 @@ TEST(MPITest_Math, CheckInterface_PETSc_Linear_Solver_gmres_amg)
     );
 }
 
+// A reused, outdated preconditioner does not lead to convergence within the
+// single allowed iteration, hence the solve is repeated with an updated
+// preconditioner starting from the original initial guess.
+TEST(MPITest_Math, PETSc_Linear_Solver_RetryWithUpdatedPreconditioner)
+{
+    int mrank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &mrank);
+
+    MathLib::PETScMatrixOption opt;
+    opt.d_nz = 2;
+    opt.o_nz = 0;
+    opt.is_global_size = false;
+    opt.n_local_cols = 2;
+    MathLib::PETScMatrix A(2, opt);
+
+    const bool is_global_size = false;
+    MathLib::PETScVector b(2, is_global_size);
+    const bool deep_copy = false;
+    MathLib::PETScVector x(b, deep_copy);
+    MathLib::PETScVector y(b, deep_copy);
+
+    // The matrix is block diagonal with one block per partition, i.e., block
+    // Jacobi with LU is an exact preconditioner.
+    std::vector<PetscInt> const pos{2 * mrank, 2 * mrank + 1};
+    auto assemble = [&](double const diagonal_factor) {
+        MathLib::DenseMatrix<double> loc_m(2, 2);
+        loc_m(0, 0) = diagonal_factor * (4. + mrank);
+        loc_m(0, 1) = 1.;
+        loc_m(1, 0) = 2.;
+        loc_m(1, 1) = diagonal_factor * (3. + mrank);
+        A.setZero();
+        A.add(pos, pos, loc_m);
+        MathLib::finalizeMatrixAssembly(A);
+    };
+
+    std::vector<double> const local_x{mrank + 1., 2. * (mrank + 1)};
+    x.set(pos, local_x);
+    MathLib::LinAlg::finalizeAssembly(x);
+    std::vector<double> x_expected;
+    x.getGlobalVector(x_expected);
+
+    const char xml[] =
+            "<petsc>"
+            "  <parameters>"
+            "    -ptest4_ksp_type gmres "
+            "    -ptest4_ksp_rtol 1.e-10 "
+            "    -ptest4_ksp_max_it 1 "
+            "    -ptest4_pc_type bjacobi "
+            "    -ptest4_sub_pc_type lu"
+            "  </parameters>"
+            "  <prefix>ptest4</prefix>"
+            "  <preconditioner_reuse>"
+            "    <max_solves>10</max_solves>"
+            "  </preconditioner_reuse>"
+            "</petsc>";
+    auto const ptree = readXml(xml);
+    BaseLib::ConfigTree const conf(ptree, "", BaseLib::ConfigTree::onerror,
+                                   BaseLib::ConfigTree::onwarning);
+    MathLib::PETScLinearSolver ls("", &conf);
+
+    // The first solve sets up the preconditioner.
+    assemble(1.);
+    MathLib::LinAlg::matMult(A, x, b);
+    y.setZero();
+    ASSERT_TRUE(ls.solve(A, b, y));
+    std::vector<double> y_global;
+    y.getGlobalVector(y_global);
+    ASSERT_ARRAY_NEAR(x_expected, y_global, x_expected.size(), 1e-8);
+
+    // Changed matrix values, the preconditioner of the first matrix is
+    // reused first.
+    assemble(2.);
+    MathLib::LinAlg::matMult(A, x, b);
+    y.setZero();
+    ASSERT_TRUE(ls.solve(A, b, y));
+    EXPECT_EQ(1, ls.getNumberOfIterations());
+    y.getGlobalVector(y_global);
+    ASSERT_ARRAY_NEAR(x_expected, y_global, x_expected.size(), 1e-8);
+}
+
 #endif
 
 
@@ -213,3 +213,53 @@ TEST(MeshLib, QuadraticOrderMesh_LineQuad)
                                           (n->getConnectedNodes().size() == 13);
                                }));
 }
+
+TEST(MeshLib, QuadraticOrderMesh_Hex)
+{
+    using namespace MeshLib;
+
+    std::unique_ptr<Mesh> linear_mesh(MeshGenerator::generateRegularHexMesh(
+        1.0, std::size_t(2)));
+    std::unique_ptr<Mesh> mesh(createQuadraticOrderMesh(*linear_mesh));
+
+    // 27 base nodes and one middle node for each of the 54 edges.
+    ASSERT_EQ(81u, mesh->getNumberOfNodes());
+    ASSERT_EQ(27u, mesh->getNumberOfBaseNodes());
+    ASSERT_EQ(8u, mesh->getNumberOfElements());
+
+    for (MeshLib::Element const* e : mesh->getElements())
+    {
+        ASSERT_EQ(MeshLib::CellType::HEX20, e->getCellType());
+        ASSERT_EQ(8u, e->getNumberOfBaseNodes());
+        ASSERT_EQ(20u, e->getNumberOfNodes());
+
+        for (unsigned i = 0; i < e->getNumberOfBaseNodes(); i++)
+        {
+            ASSERT_TRUE(mesh->isBaseNode(e->getNodeIndex(i)));
+        }
+        for (unsigned i = e->getNumberOfBaseNodes(); i < e->getNumberOfNodes();
+             i++)
+        {
+            ASSERT_FALSE(mesh->isBaseNode(e->getNodeIndex(i)));
+
+            // The middle node lies in the middle of the edge.
+            auto const edge = i - e->getNumberOfBaseNodes();
+            auto const& a = *e->getEdgeNode(edge, 0);
+            auto const& b = *e->getEdgeNode(edge, 1);
+            auto const& m = *e->getNode(i);
+            for (int c = 0; c < 3; ++c)
+            {
+                ASSERT_EQ((a[c] + b[c]) / 2, m[c]);
+            }
+        }
+    }
+
+    auto const& mesh_nodes = mesh->getNodes();
+
+    // Count nodes shared by four elements: the base nodes in the middle of the
+    // six boundary faces and the middle nodes of the six edges at the center.
+    ASSERT_EQ(12, std::count_if(mesh_nodes.begin(), mesh_nodes.end(),
+                               [](Node* const n) {
+                                   return n->getElements().size() == 4;
+                               }));
+}
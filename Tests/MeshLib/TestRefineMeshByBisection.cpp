@@ -0,0 +1,358 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/GeometricBasics.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Elements/Tri.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/ErrorIndicator.h"
+#include "MeshLib/MeshEditing/RefineMeshByBisection.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+double computeVolume(MeshLib::Mesh const& mesh)
+{
+    double volume = 0;
+    for (auto const* e : mesh.getElements())
+    {
+        volume += e->getContent();
+    }
+    return volume;
+}
+
+/// Returns the measure of the faces belonging to one element only. A hanging
+/// node increases it by faces inside the domain. Fails if a face is shared by
+/// more than two elements.
+double computeBoundaryMeasure(MeshLib::Mesh const& mesh)
+{
+    std::map<std::vector<std::size_t>, int> face_counts;
+    for (auto const* e : mesh.getElements())
+    {
+        for (unsigned i = 0; i < e->getNumberOfFaces(); ++i)
+        {
+            std::unique_ptr<MeshLib::Element const> face(e->getFace(i));
+            std::vector<std::size_t> ids;
+            for (unsigned j = 0; j < face->getNumberOfNodes(); ++j)
+            {
+                ids.push_back(face->getNodeIndex(j));
+            }
+            std::sort(ids.begin(), ids.end());
+            face_counts[ids]++;
+        }
+    }
+
+    auto const& nodes = mesh.getNodes();
+    double measure = 0;
+    for (auto const& face_count : face_counts)
+    {
+        EXPECT_GE(2, face_count.second);
+        if (face_count.second != 1)
+        {
+            continue;
+        }
+        auto const& ids = face_count.first;
+        if (ids.size() == 2)
+        {
+            measure +=
+                std::sqrt(MathLib::sqrDist(*nodes[ids[0]], *nodes[ids[1]]));
+        }
+        else
+        {
+            measure += MathLib::calcTriangleArea(
+                *nodes[ids[0]], *nodes[ids[1]], *nodes[ids[2]]);
+        }
+    }
+    return measure;
+}
+
+/// Coarsens with all elements marked until no further node is removed.
+std::unique_ptr<MeshLib::Mesh> coarsenCompletely(MeshLib::Mesh const& mesh)
+{
+    auto coarsened = MeshLib::coarsenBisectedMesh(
+        mesh, std::vector<std::size_t>(0), "coarsened");
+    while (true)
+    {
+        std::vector<std::size_t> all_elements(coarsened->getNumberOfElements());
+        std::iota(all_elements.begin(), all_elements.end(), 0);
+        auto next = MeshLib::coarsenBisectedMesh(*coarsened, all_elements,
+                                                 "coarsened");
+        if (next->getNumberOfNodes() == coarsened->getNumberOfNodes())
+        {
+            return next;
+        }
+        coarsened = std::move(next);
+    }
+}
+}  // namespace
+
+TEST(MeshLib, RefineMeshByBisectionTri)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(4u, 4u, 0.25));
+    auto& node_values = *mesh->getProperties().createNewPropertyVector<double>(
+        "u", MeshLib::MeshItemType::Node, 2);
+    for (auto const* node : mesh->getNodes())
+    {
+        node_values.push_back((*node)[0] + 2 * (*node)[1]);
+        node_values.push_back(-(*node)[0]);
+    }
+    auto& material_ids = *mesh->getProperties().createNewPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    for (std::size_t k = 0; k < mesh->getNumberOfElements(); ++k)
+    {
+        material_ids.push_back(static_cast<int>(k));
+    }
+
+    auto const refined =
+        MeshLib::refineMeshByBisection(*mesh, {0, 17}, "refined");
+
+    ASSERT_LT(mesh->getNumberOfElements(), refined->getNumberOfElements());
+    EXPECT_NEAR(computeVolume(*mesh), computeVolume(*refined), 1e-14);
+    EXPECT_NEAR(computeBoundaryMeasure(*mesh),
+                computeBoundaryMeasure(*refined), 1e-14);
+
+    // Linear fields are interpolated exactly.
+    auto const& refined_values =
+        *refined->getProperties().getPropertyVector<double>(
+            "u", MeshLib::MeshItemType::Node, 2);
+    for (auto const* node : refined->getNodes())
+    {
+        EXPECT_DOUBLE_EQ((*node)[0] + 2 * (*node)[1],
+                         refined_values.getComponent(node->getID(), 0));
+        EXPECT_DOUBLE_EQ(-(*node)[0],
+                         refined_values.getComponent(node->getID(), 1));
+    }
+
+    // The children inherit the material id and lie inside their parent.
+    auto const& refined_material_ids =
+        *refined->getProperties().getPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    std::vector<double> children_volume(mesh->getNumberOfElements(), 0);
+    for (auto const* e : refined->getElements())
+    {
+        auto const parent = refined_material_ids[e->getID()];
+        children_volume[parent] += e->getContent();
+        EXPECT_TRUE(mesh->getElement(parent)->isPntInElement(
+            MathLib::Point3d(e->getCenterOfGravity()), 1e-14));
+    }
+    for (std::size_t k = 0; k < mesh->getNumberOfElements(); ++k)
+    {
+        EXPECT_NEAR(mesh->getElement(k)->getContent(), children_volume[k],
+                    1e-14);
+    }
+}
+
+TEST(MeshLib, RefineMeshByBisectionTet)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTetMesh(1.0, 1.0, 1.0, 3, 3,
+                                                       3));
+
+    std::vector<std::size_t> marked_elements;
+    for (std::size_t k = 0; k < mesh->getNumberOfElements(); k += 7)
+    {
+        marked_elements.push_back(k);
+    }
+    auto refined =
+        MeshLib::refineMeshByBisection(*mesh, marked_elements, "refined");
+    // Refine once more to bisect the newly created edges.
+    refined = MeshLib::refineMeshByBisection(*refined, {0, 1, 2, 3}, "refined");
+
+    ASSERT_LT(mesh->getNumberOfElements(), refined->getNumberOfElements());
+    EXPECT_NEAR(computeVolume(*mesh), computeVolume(*refined), 1e-14);
+    EXPECT_NEAR(computeBoundaryMeasure(*mesh),
+                computeBoundaryMeasure(*refined), 1e-13);
+    for (auto const* e : refined->getElements())
+    {
+        EXPECT_LT(0, e->getContent());
+    }
+}
+
+TEST(MeshLib, GradientErrorIndicator)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(4u, 4u, 0.25));
+
+    // A front at x = 0.5, which is steep in the elements of the middle
+    // columns.
+    std::vector<double> values;
+    for (auto const* node : mesh->getNodes())
+    {
+        values.push_back(std::tanh(20 * ((*node)[0] - 0.5)));
+    }
+    auto const indicator =
+        MeshLib::computeGradientErrorIndicator(*mesh, values);
+    ASSERT_EQ(mesh->getNumberOfElements(), indicator.size());
+
+    auto const marked_elements =
+        MeshLib::markElementsForRefinement(indicator, 0.5);
+    ASSERT_FALSE(marked_elements.empty());
+    for (auto const k : marked_elements)
+    {
+        auto const x = mesh->getElement(k)->getCenterOfGravity()[0];
+        EXPECT_LT(0.25, x);
+        EXPECT_GT(0.75, x);
+    }
+
+    // The gradient of a linear field is exact.
+    std::vector<double> linear_values;
+    for (auto const* node : mesh->getNodes())
+    {
+        linear_values.push_back(3 * (*node)[0] - 4 * (*node)[1]);
+    }
+    auto const linear_indicator =
+        MeshLib::computeGradientErrorIndicator(*mesh, linear_values);
+    for (auto const eta : linear_indicator)
+    {
+        // The longest edge is the diagonal of a 0.25 x 0.25 cell.
+        EXPECT_NEAR(5 * 0.25 * std::sqrt(2.), eta, 1e-12);
+    }
+}
+
+TEST(MeshLib, CoarsenBisectedMeshTri)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(4u, 4u, 0.25));
+    auto& node_values = *mesh->getProperties().createNewPropertyVector<double>(
+        "u", MeshLib::MeshItemType::Node, 1);
+    for (auto const* node : mesh->getNodes())
+    {
+        node_values.push_back((*node)[0] + 2 * (*node)[1]);
+    }
+    auto& material_ids = *mesh->getProperties().createNewPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    for (std::size_t k = 0; k < mesh->getNumberOfElements(); ++k)
+    {
+        material_ids.push_back(static_cast<int>(k));
+    }
+
+    auto refined = MeshLib::refineMeshByBisection(*mesh, {0, 17}, "refined");
+    refined = MeshLib::refineMeshByBisection(*refined, {0, 1}, "refined");
+
+    // Unmarked elements are not coarsened.
+    auto const unchanged = MeshLib::coarsenBisectedMesh(
+        *refined, std::vector<std::size_t>(0), "coarsened");
+    EXPECT_EQ(refined->getNumberOfNodes(), unchanged->getNumberOfNodes());
+    EXPECT_EQ(refined->getNumberOfElements(),
+              unchanged->getNumberOfElements());
+
+    // Coarsening of the lower part only keeps the refinement of the upper
+    // part and the mesh conforming.
+    std::vector<std::size_t> marked_elements;
+    for (auto const* e : refined->getElements())
+    {
+        if (e->getCenterOfGravity()[1] < 0.4)
+        {
+            marked_elements.push_back(e->getID());
+        }
+    }
+    auto const partially_coarsened =
+        MeshLib::coarsenBisectedMesh(*refined, marked_elements, "coarsened");
+    EXPECT_GT(refined->getNumberOfNodes(),
+              partially_coarsened->getNumberOfNodes());
+    EXPECT_LT(mesh->getNumberOfNodes(),
+              partially_coarsened->getNumberOfNodes());
+    EXPECT_NEAR(computeVolume(*mesh), computeVolume(*partially_coarsened),
+                1e-14);
+    EXPECT_NEAR(computeBoundaryMeasure(*mesh),
+                computeBoundaryMeasure(*partially_coarsened), 1e-14);
+
+    // Complete coarsening restores the original mesh.
+    auto const coarsened = coarsenCompletely(*refined);
+    ASSERT_EQ(mesh->getNumberOfNodes(), coarsened->getNumberOfNodes());
+    ASSERT_EQ(mesh->getNumberOfElements(), coarsened->getNumberOfElements());
+    EXPECT_NEAR(computeBoundaryMeasure(*mesh),
+                computeBoundaryMeasure(*coarsened), 1e-14);
+
+    auto const& coarsened_values =
+        *coarsened->getProperties().getPropertyVector<double>(
+            "u", MeshLib::MeshItemType::Node, 1);
+    for (auto const* node : coarsened->getNodes())
+    {
+        EXPECT_DOUBLE_EQ((*node)[0] + 2 * (*node)[1],
+                         coarsened_values[node->getID()]);
+    }
+
+    // Each element is the original element with the copied material id.
+    auto const& coarsened_material_ids =
+        *coarsened->getProperties().getPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    for (auto const* e : coarsened->getElements())
+    {
+        auto const& original =
+            *mesh->getElement(coarsened_material_ids[e->getID()]);
+        EXPECT_NEAR(original.getContent(), e->getContent(), 1e-14);
+        for (unsigned i = 0; i < e->getNumberOfNodes(); ++i)
+        {
+            EXPECT_TRUE(original.isPntInElement(*e->getNode(i), 1e-14));
+        }
+    }
+}
+
+TEST(MeshLib, CoarsenBisectedMeshTet)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTetMesh(1.0, 1.0, 1.0, 3, 3,
+                                                       3));
+
+    std::vector<std::size_t> marked_elements;
+    for (std::size_t k = 0; k < mesh->getNumberOfElements(); k += 7)
+    {
+        marked_elements.push_back(k);
+    }
+    auto refined =
+        MeshLib::refineMeshByBisection(*mesh, marked_elements, "refined");
+    refined = MeshLib::refineMeshByBisection(*refined, {0, 1, 2, 3}, "refined");
+
+    auto const coarsened = coarsenCompletely(*refined);
+    EXPECT_EQ(mesh->getNumberOfNodes(), coarsened->getNumberOfNodes());
+    EXPECT_EQ(mesh->getNumberOfElements(), coarsened->getNumberOfElements());
+    EXPECT_NEAR(computeVolume(*mesh), computeVolume(*coarsened), 1e-14);
+    EXPECT_NEAR(computeBoundaryMeasure(*mesh),
+                computeBoundaryMeasure(*coarsened), 1e-13);
+    for (auto const* e : coarsened->getElements())
+    {
+        EXPECT_LT(0, e->getContent());
+    }
+}
+
+TEST(MeshLib, GradientErrorIndicatorDegenerateElement)
+{
+    std::vector<MeshLib::Node*> nodes{new MeshLib::Node(0, 0, 0),
+                                      new MeshLib::Node(1, 0, 0),
+                                      new MeshLib::Node(2, 0, 0)};
+    std::vector<MeshLib::Element*> elements{new MeshLib::Tri(
+        std::array<MeshLib::Node*, 3>{{nodes[0], nodes[1], nodes[2]}})};
+    MeshLib::Mesh const mesh("degenerate", nodes, elements);
+
+    EXPECT_ANY_THROW(
+        MeshLib::computeGradientErrorIndicator(mesh, {0.0, 1.0, 3.0}));
+}
+
+TEST(MeshLib, MarkElementsForCoarsening)
+{
+    std::vector<double> const indicator{0.1, 1.0, 0.3, 0.0};
+    EXPECT_EQ((std::vector<std::size_t>{0, 3}),
+              MeshLib::markElementsForCoarsening(indicator, 0.2));
+    EXPECT_EQ((std::vector<std::size_t>{0, 2, 3}),
+              MeshLib::markElementsForCoarsening(indicator, 0.3));
+}
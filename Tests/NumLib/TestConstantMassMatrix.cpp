@@ -0,0 +1,102 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
+
+namespace
+{
+// M x' + K x = b with M = diag(2, 3), K = I, b = 0.
+class ConstantMassMatrixODE final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Picard>
+{
+public:
+    void preAssemble(const double /*t*/, double const /*dt*/,
+                     GlobalVector const& /*x*/) override
+    {
+    }
+
+    void assemble(const double /*t*/, double const /*dt*/,
+                  std::vector<GlobalVector*> const& /*x*/,
+                  int const /*process_id*/, GlobalMatrix& M, GlobalMatrix& K,
+                  GlobalVector& b) override
+    {
+        if (_assemble_M)
+        {
+            MathLib::setMatrix(M, {2.0, 0.0, 0.0, 3.0});
+            ++number_of_M_assemblies;
+        }
+        MathLib::setMatrix(K, {1.0, 0.0, 0.0, 1.0});
+        MathLib::setVector(b, {0.0, 0.0});
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications(
+        const int /*process_id*/) const override
+    {
+        return {2, 2, nullptr, nullptr};
+    }
+
+    bool isLinear() const override { return true; }
+
+    bool isMassMatrixConstant(int const /*process_id*/) const override
+    {
+        return true;
+    }
+
+    void setMassMatrixAssembly(bool const enabled) override
+    {
+        _assemble_M = enabled;
+    }
+
+    int number_of_M_assemblies = 0;
+
+private:
+    bool _assemble_M = true;
+};
+}  // namespace
+
+TEST(NumLibODESolver, ConstantMassMatrixIsAssembledOnce)
+{
+    ConstantMassMatrixODE ode;
+    NumLib::BackwardEuler time_disc;
+
+    GlobalVector x(2);
+    MathLib::setVector(x, {1.0, 1.0});
+    MathLib::LinAlg::finalizeAssembly(x);
+
+    double const dt = 0.5;
+    time_disc.setInitialState(0.0, x);
+    time_disc.nextTimestep(dt, dt);
+
+    NumLib::TimeDiscretizedODESystem<
+        NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+        NumLib::NonlinearSolverTag::Picard>
+        ode_sys(0, ode, time_disc);
+
+    std::vector<GlobalVector*> xs{&x};
+    GlobalMatrix A(2);
+    GlobalVector Ax(2);
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        ode_sys.assemble(xs, 0);
+        EXPECT_EQ(1, ode.number_of_M_assemblies);
+
+        // A = M / dt + K stays the same in all iterations.
+        ode_sys.getA(A);
+        MathLib::LinAlg::finalizeAssembly(A);
+        MathLib::LinAlg::matMult(A, x, Ax);
+        EXPECT_DOUBLE_EQ(2.0 / dt + 1.0, Ax.get(0));
+        EXPECT_DOUBLE_EQ(3.0 / dt + 1.0, Ax.get(1));
+    }
+}
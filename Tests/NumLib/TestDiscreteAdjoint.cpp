@@ -0,0 +1,330 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/NumericsConfig.h"
+#include "NumLib/ODESolver/DiscreteAdjointSolver.h"
+
+#ifndef USE_PETSC
+
+namespace
+{
+/// Linear ODE system dx/dt = -A(p) x with
+/// A = [[p_0, 1], [0, p_1]] discretized with the backward Euler scheme, i.e.,
+/// R_n = (I/dt + A) x_n - x_{n-1}/dt.
+struct LinearODE
+{
+    LinearODE(std::array<double, 2> const& p_, double const dt_)
+        : p(p_), dt(dt_)
+    {
+    }
+
+    void assembleJacobian(GlobalMatrix& J) const
+    {
+        J.setZero();
+        J.add(0, 0, 1.0 / dt + p[0]);
+        J.add(0, 1, 1.0);
+        J.add(1, 1, 1.0 / dt + p[1]);
+        MathLib::LinAlg::finalizeAssembly(J);
+    }
+
+    void assembleJacobianPreviousState(GlobalMatrix& B) const
+    {
+        B.setZero();
+        B.add(0, 0, -1.0 / dt);
+        B.add(1, 1, -1.0 / dt);
+        MathLib::LinAlg::finalizeAssembly(B);
+    }
+
+    // Solves the upper triangular system of one time step.
+    void step(GlobalVector const& x_prev, GlobalVector& x) const
+    {
+        x[1] = x_prev[1] / dt / (1.0 / dt + p[1]);
+        x[0] = (x_prev[0] / dt - x[1]) / (1.0 / dt + p[0]);
+    }
+
+    std::array<double, 2> p;
+    double dt;
+};
+
+std::array<double, 2> const x0{{1.0, 2.0}};
+
+std::unique_ptr<GlobalLinearSolver> createLinearSolver()
+{
+    boost::property_tree::ptree t_root;
+    {
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", "BiCGSTAB");
+        t_solver.put("precon_type", "NONE");
+        t_solver.put("error_tolerance", 1e-16);
+        t_solver.put("max_iteration_step", 1000);
+        t_root.put_child("eigen", t_solver);
+    }
+    t_root.put("lis", "-i bicgstab -p none -tol 1e-16 -maxiter 1000");
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    return std::make_unique<GlobalLinearSolver>("", &conf);
+}
+
+// Objective function F = x_N,0 + 2 x_N,1.
+double solveForward(LinearODE const& ode, std::size_t const n_steps,
+                    NumLib::DiscreteAdjointSolver* adjoint)
+{
+    GlobalVector x_prev(2);
+    GlobalVector x(2);
+    x_prev[0] = x0[0];
+    x_prev[1] = x0[1];
+
+    GlobalMatrix J(2);
+    GlobalMatrix B(2);
+    ode.assembleJacobian(J);
+    ode.assembleJacobianPreviousState(B);
+
+    for (std::size_t n = 0; n < n_steps; ++n)
+    {
+        ode.step(x_prev, x);
+        if (adjoint)
+        {
+            adjoint->recordTimeStep(x, J, B);
+        }
+        MathLib::LinAlg::copy(x, x_prev);
+    }
+    return x[0] + 2.0 * x[1];
+}
+
+/// Linear finite element discretization of the 1D heat equation
+/// rho c dT/dt = d/dx (k dT/dx) on [0, 1] with insulated boundaries and the
+/// backward Euler scheme, i.e., R_n = (M/dt + K) T_n - M/dt T_{n-1}.
+struct HeatConduction1D
+{
+    static std::size_t const n_nodes = 21;
+
+    explicit HeatConduction1D(double const k_) : k(k_) {}
+
+    // Adds the element matrices a * [[2, 1], [1, 2]] of M and
+    // b * [[1, -1], [-1, 1]] of K.
+    static void assembleMatrix(GlobalMatrix& A, double const a, double const b)
+    {
+        A.setZero();
+        for (std::size_t e = 0; e + 1 < n_nodes; ++e)
+        {
+            A.add(e, e, 2 * a + b);
+            A.add(e, e + 1, a - b);
+            A.add(e + 1, e, a - b);
+            A.add(e + 1, e + 1, 2 * a + b);
+        }
+        MathLib::LinAlg::finalizeAssembly(A);
+    }
+
+    // M/dt + K
+    void assembleJacobian(GlobalMatrix& J) const
+    {
+        assembleMatrix(J, rho_c * h / 6 / dt, k / h);
+    }
+
+    // -M/dt
+    void assembleJacobianPreviousState(GlobalMatrix& B) const
+    {
+        assembleMatrix(B, -rho_c * h / 6 / dt, 0);
+    }
+
+    // dR/dk = K/k T
+    void residualConductivityDerivative(GlobalVector const& T,
+                                        GlobalVector& dR_dk) const
+    {
+        for (std::size_t e = 0; e + 1 < n_nodes; ++e)
+        {
+            double const flux = (T[e] - T[e + 1]) / h;
+            dR_dk[e] += flux;
+            dR_dk[e + 1] -= flux;
+        }
+    }
+
+    double k;
+    double const rho_c = 2.0;
+    double const h = 1.0 / (n_nodes - 1);
+    double const dt = 0.01;
+};
+
+// Objective function F = dt sum_n T_n at the right boundary, i.e., the time
+// integral of the temperature at an observation point.
+double solveHeatConduction(HeatConduction1D const& problem, std::size_t const n_steps,
+                    GlobalLinearSolver& linear_solver,
+                    NumLib::DiscreteAdjointSolver* adjoint)
+{
+    std::size_t const n = HeatConduction1D::n_nodes;
+    GlobalVector T_prev(n);
+    GlobalVector T(n);
+    GlobalVector rhs(n);
+    // Initially hot left quarter.
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        T_prev[i] = i < n / 4 ? 1.0 : 0.0;
+    }
+
+    GlobalMatrix J(n);
+    GlobalMatrix B(n);
+    problem.assembleJacobian(J);
+    problem.assembleJacobianPreviousState(B);
+
+    double F = 0;
+    for (std::size_t step = 0; step < n_steps; ++step)
+    {
+        // J T_n = -B T_{n-1}
+        MathLib::LinAlg::matMult(B, T_prev, rhs);
+        MathLib::LinAlg::scale(rhs, -1.0);
+        MathLib::LinAlg::copy(T_prev, T);
+        if (!linear_solver.solve(J, rhs, T))
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (adjoint)
+        {
+            adjoint->recordTimeStep(T, J, B);
+        }
+        F += problem.dt * T[n - 1];
+        MathLib::LinAlg::copy(T, T_prev);
+    }
+    return F;
+}
+}  // namespace
+
+TEST(NumLibDiscreteAdjoint, GradientMatchesFiniteDifferences)
+{
+    std::size_t const n_steps = 10;
+    LinearODE const ode{{{0.5, 2.0}}, 0.1};
+
+    auto linear_solver = createLinearSolver();
+    NumLib::DiscreteAdjointSolver adjoint(*linear_solver);
+    solveForward(ode, n_steps, &adjoint);
+    ASSERT_EQ(n_steps, adjoint.getNumberOfTimeSteps());
+
+    auto const gradient = adjoint.computeGradient(
+        [&](std::size_t const time_step, GlobalVector const& /*x*/,
+            GlobalVector& dF_dx) {
+            if (time_step == n_steps - 1)
+            {
+                dF_dx[0] = 1.0;
+                dF_dx[1] = 2.0;
+            }
+        },
+        [](std::size_t const /*time_step*/, GlobalVector const& x,
+           std::size_t const parameter, GlobalVector& dR_dp) {
+            dR_dp[parameter] = x[parameter];
+        },
+        2);
+    ASSERT_EQ(2u, gradient.size());
+
+    double const eps = 1e-6;
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        LinearODE ode_plus = ode;
+        LinearODE ode_minus = ode;
+        ode_plus.p[i] += eps;
+        ode_minus.p[i] -= eps;
+        double const fd = (solveForward(ode_plus, n_steps, nullptr) -
+                           solveForward(ode_minus, n_steps, nullptr)) /
+                          (2 * eps);
+        EXPECT_NEAR(fd, gradient[i], 1e-6 * std::abs(fd));
+    }
+}
+
+TEST(NumLibDiscreteAdjoint, ScalarDecayAnalytical)
+{
+    // dx/dt = -p x, F = x_N; dF/dp = -N dt x_0 / (1 + p dt)^(N+1).
+    std::size_t const n_steps = 20;
+    double const p = 1.5;
+    double const dt = 0.05;
+
+    auto linear_solver = createLinearSolver();
+    NumLib::DiscreteAdjointSolver adjoint(*linear_solver);
+
+    GlobalMatrix J(1);
+    GlobalMatrix B(1);
+    J.add(0, 0, 1.0 / dt + p);
+    B.add(0, 0, -1.0 / dt);
+    MathLib::LinAlg::finalizeAssembly(J);
+    MathLib::LinAlg::finalizeAssembly(B);
+
+    GlobalVector x(1);
+    x[0] = 1.0;
+    for (std::size_t n = 0; n < n_steps; ++n)
+    {
+        x[0] /= 1.0 + p * dt;
+        adjoint.recordTimeStep(x, J, B);
+    }
+
+    auto const gradient = adjoint.computeGradient(
+        [&](std::size_t const time_step, GlobalVector const& /*x*/,
+            GlobalVector& dF_dx) {
+            if (time_step == n_steps - 1)
+            {
+                dF_dx[0] = 1.0;
+            }
+        },
+        [](std::size_t const /*time_step*/, GlobalVector const& x,
+           std::size_t const /*parameter*/,
+           GlobalVector& dR_dp) { dR_dp[0] = x[0]; },
+        1);
+
+    double const expected =
+        -static_cast<double>(n_steps) * dt / std::pow(1.0 + p * dt, n_steps + 1);
+    EXPECT_NEAR(expected, gradient[0], 1e-12);
+
+    adjoint.clear();
+    ASSERT_EQ(0u, adjoint.getNumberOfTimeSteps());
+}
+
+TEST(NumLibDiscreteAdjoint, HeatConductionConductivityGradient)
+{
+    std::size_t const n_steps = 30;
+    double const k = 0.8;
+    HeatConduction1D const problem{k};
+
+    auto linear_solver = createLinearSolver();
+    NumLib::DiscreteAdjointSolver adjoint(*linear_solver);
+    solveHeatConduction(problem, n_steps, *linear_solver, &adjoint);
+    ASSERT_EQ(n_steps, adjoint.getNumberOfTimeSteps());
+
+    auto const gradient = adjoint.computeGradient(
+        [&](std::size_t const /*time_step*/, GlobalVector const& /*x*/,
+            GlobalVector& dF_dx) {
+            dF_dx[HeatConduction1D::n_nodes - 1] = problem.dt;
+        },
+        [&](std::size_t const /*time_step*/, GlobalVector const& x,
+            std::size_t const /*parameter*/, GlobalVector& dR_dp) {
+            problem.residualConductivityDerivative(x, dR_dp);
+        },
+        1);
+    ASSERT_EQ(1u, gradient.size());
+    // Heat reaches the observation point faster with a higher conductivity.
+    EXPECT_GT(gradient[0], 0.0);
+
+    double const eps = 1e-5;
+    double const fd =
+        (solveHeatConduction(HeatConduction1D{k + eps}, n_steps,
+                             *linear_solver, nullptr) -
+         solveHeatConduction(HeatConduction1D{k - eps}, n_steps,
+                             *linear_solver, nullptr)) /
+        (2 * eps);
+    EXPECT_NEAR(fd, gradient[0], 1e-6 * std::abs(fd));
+}
+
+#endif  // USE_PETSC
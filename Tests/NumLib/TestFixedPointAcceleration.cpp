@@ -0,0 +1,145 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/NumericsConfig.h"
+#include "NumLib/ODESolver/FixedPointAcceleration.h"
+
+#ifndef USE_PETSC
+
+namespace
+{
+// Linear contraction G(x) = B x + c with a spectral radius of B close to one,
+// i.e., a slowly converging fixed-point iteration with the fixed point
+// x* = (I - B)^{-1} c = (1, 2, 3).
+void applyG(GlobalVector const& x, GlobalVector& g)
+{
+    g[0] = 0.9 * x[0] + 0.1;
+    g[1] = 0.5 * x[1] + 0.05 * x[0] + 0.95;
+    g[2] = -0.8 * x[2] + 0.1 * x[1] + 5.2;
+}
+
+// Returns the number of iterations needed to reach |x_k - G(x_k)| < 1e-10.
+int iterate(NumLib::FixedPointAcceleration* const acceleration,
+            GlobalVector& x)
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    GlobalVector g(3);
+    GlobalVector dx(3);
+    for (int iteration = 1; iteration <= 1000; ++iteration)
+    {
+        applyG(x, g);
+        LinAlg::copy(x, dx);
+        LinAlg::axpy(dx, -1.0, g);  // dx = x - G(x)
+        if (LinAlg::norm2(dx) < 1e-10)
+        {
+            return iteration;
+        }
+        if (acceleration)
+        {
+            acceleration->accelerate(g, dx);
+        }
+        LinAlg::copy(g, x);
+    }
+    return -1;
+}
+}  // namespace
+
+TEST(NumLibFixedPointAcceleration, ConvergesFasterThanPlainIteration)
+{
+    GlobalVector x(3);
+
+    x.setZero();
+    int const plain_iterations = iterate(nullptr, x);
+    ASSERT_GT(plain_iterations, 0);
+
+    NumLib::AitkenRelaxation aitken(0.5);
+    x.setZero();
+    int const aitken_iterations = iterate(&aitken, x);
+    ASSERT_GT(aitken_iterations, 0);
+    EXPECT_LT(aitken_iterations, plain_iterations);
+    EXPECT_NEAR(1.0, x[0], 1e-8);
+    EXPECT_NEAR(2.0, x[1], 1e-8);
+    EXPECT_NEAR(3.0, x[2], 1e-8);
+
+    // For a linear map of dimension n Anderson acceleration with a history of
+    // at least n converges after about n + 1 iterations.
+    NumLib::AndersonAcceleration anderson(5, 1.0);
+    x.setZero();
+    int const anderson_iterations = iterate(&anderson, x);
+    ASSERT_GT(anderson_iterations, 0);
+    EXPECT_LE(anderson_iterations, 7);
+    EXPECT_NEAR(1.0, x[0], 1e-8);
+    EXPECT_NEAR(2.0, x[1], 1e-8);
+    EXPECT_NEAR(3.0, x[2], 1e-8);
+
+    // After a reset the history of the previous run is not used.
+    anderson.reset();
+    x.setZero();
+    EXPECT_EQ(anderson_iterations, iterate(&anderson, x));
+}
+
+TEST(NumLibFixedPointAcceleration, AcceptsLastSolvedIterate)
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    // Gauss-Seidel sweeps over two coupled scalar equations
+    //   a = 0.9 b - 0.8,  b = 0.5 a + 1.5,
+    // each unknown is accelerated with its own Anderson acceleration.
+    std::vector<std::unique_ptr<NumLib::FixedPointAcceleration>>
+        accelerations;
+    accelerations.push_back(
+        std::make_unique<NumLib::AndersonAcceleration>(3, 1.0));
+    accelerations.push_back(
+        std::make_unique<NumLib::AndersonAcceleration>(3, 1.0));
+
+    GlobalVector a(1);
+    GlobalVector b(1);
+    GlobalVector a_old(1);
+    GlobalVector b_old(1);
+    a.setZero();
+    b.setZero();
+    std::vector<GlobalVector*> const x{&a, &b};
+    std::vector<GlobalVector*> const x_old{&a_old, &b_old};
+
+    bool converged = false;
+    double last_solved_a = 0;
+    double last_solved_b = 0;
+    for (int iteration = 0; iteration < 100 && !converged; ++iteration)
+    {
+        LinAlg::copy(a, a_old);
+        LinAlg::copy(b, b_old);
+        a[0] = 0.9 * b[0] - 0.8;
+        b[0] = 0.5 * a[0] + 1.5;
+        last_solved_a = a[0];
+        last_solved_b = b[0];
+
+        LinAlg::axpy(a_old, -1.0, a);  // a_old = -da
+        LinAlg::axpy(b_old, -1.0, b);  // b_old = -db
+        converged = LinAlg::norm2(b_old) < 1e-10;
+
+        NumLib::accelerateUnlessConverged(converged, accelerations, x, x_old);
+    }
+
+    ASSERT_TRUE(converged);
+    // The converged solution is the one of the last sweep, not an
+    // accelerated extrapolation of it.
+    EXPECT_EQ(last_solved_a, a[0]);
+    EXPECT_EQ(last_solved_b, b[0]);
+    EXPECT_NEAR(1.0, a[0], 1e-8);
+    EXPECT_NEAR(2.0, b[0], 1e-8);
+}
+
+#endif  // USE_PETSC
@@ -0,0 +1,50 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "NumLib/ODESolver/InexactNewtonForcingTerm.h"
+
+TEST(NumLibInexactNewtonForcingTerm, EisenstatWalkerChoice2)
+{
+    NumLib::InexactNewtonForcingTerm forcing_term(0.5, 0.9, 0.9, 2.0);
+
+    EXPECT_DOUBLE_EQ(0.5, forcing_term.next(1.0));
+
+    // Slow decrease of the residual: limited by the maximum forcing term.
+    EXPECT_DOUBLE_EQ(0.9, forcing_term.next(1.0));
+
+    // Fast decrease of the residual, but the safeguard 0.9 * 0.9^2 = 0.729
+    // keeps the forcing term from dropping.
+    EXPECT_DOUBLE_EQ(0.729, forcing_term.next(0.1));
+
+    // The safeguard 0.9 * 0.729^2 = 0.478... is still above 0.1.
+    EXPECT_DOUBLE_EQ(0.9 * 0.729 * 0.729, forcing_term.next(1e-3));
+
+    // Quadratic convergence: 0.9 * (1e-6 / 1e-3)^2 = 9e-7, the safeguard
+    // 0.9 * 0.478...^2 = 0.206 still applies.
+    double const safeguard = 0.9 * std::pow(0.9 * 0.729 * 0.729, 2);
+    EXPECT_DOUBLE_EQ(safeguard, forcing_term.next(1e-6));
+
+    // Once the safeguard drops below 0.1 the forcing term follows the
+    // residual reduction.
+    double eta = safeguard;
+    double residual = 1e-6;
+    while (0.9 * eta * eta > 0.1)
+    {
+        residual *= 0.5;
+        eta = forcing_term.next(residual);
+    }
+    EXPECT_DOUBLE_EQ(0.9 * 1e-4, forcing_term.next(residual * 1e-2));
+
+    forcing_term.reset();
+    EXPECT_DOUBLE_EQ(0.5, forcing_term.next(1e-10));
+}
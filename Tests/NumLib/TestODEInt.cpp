@@ -298,3 +298,65 @@ TYPED_TEST(NumLibODEIntTyped, DISABLED_T1)
  * * check that the order of time discretization scales correctly
  *   with the timestep size
  */
+
+#ifndef USE_PETSC
+// Integrates ODE3 with the Picard method and returns the solution at the end
+// time and the total number of Picard iterations.
+std::pair<GlobalVector, int> runPicard(
+    std::unique_ptr<NumLib::FixedPointAcceleration>&& acceleration)
+{
+    using NLSolver =
+        NumLib::NonlinearSolver<NumLib::NonlinearSolverTag::Picard>;
+
+    ODE3 ode;
+    NumLib::BackwardEuler time_disc;
+    int const process_id = 0;
+    NumLib::TimeDiscretizedODESystem<ODE3::ODETag,
+                                     NumLib::NonlinearSolverTag::Picard>
+        ode_sys(process_id, ode, time_disc);
+
+    auto linear_solver = createLinearSolver();
+    auto conv_crit = std::make_unique<NumLib::ConvergenceCriterionDeltaX>(
+        1e-9, boost::none, MathLib::VecNormType::NORM2);
+    auto nonlinear_solver = std::make_unique<NLSolver>(
+        *linear_solver, 100, std::move(acceleration));
+
+    NumLib::TimeLoopSingleODE<NumLib::NonlinearSolverTag::Picard> loop(
+        ode_sys, std::move(linear_solver), std::move(nonlinear_solver),
+        std::move(conv_crit));
+
+    GlobalVector x0(2);
+    ODETraits<ODE3>::setIC(x0);
+
+    std::pair<GlobalVector, int> result{x0, 0};
+    auto const t_end = ODETraits<ODE3>::t_end;
+    auto const delta_t = (t_end - ODETraits<ODE3>::t0) / 10;
+    auto cb = [&result](const double /*t*/, GlobalVector const& x) {
+        result.first = x;
+    };
+    // The number of iterations is summed over all time steps by running the
+    // single time steps one after another.
+    for (int timestep = 0; timestep < 10; ++timestep)
+    {
+        auto const t = ODETraits<ODE3>::t0 + timestep * delta_t;
+        GlobalVector const x = result.first;
+        auto const status = loop.loop(t, x, t + delta_t, delta_t, cb);
+        EXPECT_TRUE(status.error_norms_met);
+        result.second += status.number_iterations;
+    }
+    return result;
+}
+
+TEST(NumLibODEInt, PicardAndersonAcceleration)
+{
+    auto const plain = runPicard(nullptr);
+    auto const anderson =
+        runPicard(std::make_unique<NumLib::AndersonAcceleration>(5, 1.0));
+
+    EXPECT_LT(anderson.second, plain.second);
+    for (int comp = 0; comp < 2; ++comp)
+    {
+        EXPECT_NEAR(plain.first[comp], anderson.first[comp], 1e-8);
+    }
+}
+#endif  // USE_PETSC
@@ -0,0 +1,98 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "NumLib/Assembler/ParallelExecutor.h"
+
+namespace
+{
+struct LocalAssemblerMock
+{
+    void assemble(std::size_t const id, std::vector<double>& global_b,
+                  std::size_t const throw_at_id)
+    {
+        if (id == throw_at_id)
+        {
+            throw std::runtime_error("Assembly failed.");
+        }
+
+        value = 2.0 * id;
+        ++number_of_calls;
+
+        // The global vector is shared by all local assemblers; every entry is
+        // touched by several of them.
+        NumLib::ParallelExecutor::executeExclusively([&]() {
+            global_b[id % global_b.size()] += value;
+        });
+    }
+
+    double value = 0;
+    int number_of_calls = 0;
+};
+
+std::vector<std::unique_ptr<LocalAssemblerMock>> createLocalAssemblers(
+    std::size_t const n)
+{
+    std::vector<std::unique_ptr<LocalAssemblerMock>> local_assemblers;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        local_assemblers.push_back(std::make_unique<LocalAssemblerMock>());
+    }
+    return local_assemblers;
+}
+}  // namespace
+
+TEST(NumLibParallelExecutor, ExecuteMemberOnDereferenced)
+{
+    std::size_t const n = 1000;
+    auto const local_assemblers = createLocalAssemblers(n);
+    std::vector<double> global_b(7, 0.0);
+
+    NumLib::ParallelExecutor::executeMemberOnDereferenced(
+        &LocalAssemblerMock::assemble, local_assemblers, global_b,
+        std::size_t{n});
+
+    double expected_sum = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(1, local_assemblers[i]->number_of_calls);
+        ASSERT_EQ(2.0 * i, local_assemblers[i]->value);
+        expected_sum += 2.0 * i;
+    }
+
+    double sum = 0;
+    for (auto const b : global_b)
+    {
+        sum += b;
+    }
+    ASSERT_EQ(expected_sum, sum);
+}
+
+TEST(NumLibParallelExecutor, ExceptionIsRethrown)
+{
+    std::size_t const n = 100;
+    auto const local_assemblers = createLocalAssemblers(n);
+    std::vector<double> global_b(7, 0.0);
+
+    ASSERT_THROW(NumLib::ParallelExecutor::executeMemberOnDereferenced(
+                     &LocalAssemblerMock::assemble, local_assemblers,
+                     global_b, std::size_t{42}),
+                 std::runtime_error);
+
+    // All other local assemblers have been executed nevertheless.
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        ASSERT_EQ(i == 42 ? 0 : 1, local_assemblers[i]->number_of_calls);
+    }
+}
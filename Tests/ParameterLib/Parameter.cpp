@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "BaseLib/ConfigTree.h"
+#include "InfoLib/TestInfo.h"
 #include "Tests/TestTools.h"
 
 #include "MeshLib/Mesh.h"
@@ -25,6 +26,7 @@
 
 #include "ParameterLib/CurveScaledParameter.h"
 #include "ParameterLib/GroupBasedParameter.h"
+#include "ParameterLib/StreamedTimeSeriesParameter.h"
 
 using namespace ParameterLib;
 
@@ -255,3 +257,122 @@ TEST_F(ParameterLibParameter, GetNodalValuesOnElement_curveScaledNode)
     ASSERT_TRUE(testNodalValuesOfElement(meshes[0]->getElements(),
                                          expected_value, *parameter, t));
 }
+
+TEST_F(ParameterLibParameter, GetNodalValues_constant)
+{
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>Constant</type>"
+        "<values>1 2</values>",
+        meshes);
+
+    std::vector<double> values;
+    parameter->getNodalValues(0, {4, 0, 2}, values);
+
+    ASSERT_EQ((std::vector<double>{1, 2, 1, 2, 1, 2}), values);
+}
+
+TEST_F(ParameterLibParameter, GetNodalValues_node)
+{
+    std::vector<double> node_ids({0, 1, 2, 3, 4});
+    MeshLib::addPropertyToMesh(*meshes[0], "NodeIDs",
+                               MeshLib::MeshItemType::Node, 1, node_ids);
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>MeshNode</type>"
+        "<field_name>NodeIDs</field_name>",
+        meshes);
+
+    std::vector<double> values;
+    parameter->getNodalValues(0, {4, 0, 2}, values);
+
+    ASSERT_EQ((std::vector<double>{4, 0, 2}), values);
+}
+
+TEST_F(ParameterLibParameter, GetNodalValues_curveScaledNode)
+{
+    std::vector<double> node_ids({0, 1, 2, 3, 4});
+    MeshLib::addPropertyToMesh(*meshes[0], "NodeIDs",
+                               MeshLib::MeshItemType::Node, 1, node_ids);
+
+    std::vector<std::unique_ptr<ParameterBase>> parameters;
+    parameters.emplace_back(
+        constructParameterFromString("<name>NodeIDs</name>"
+                                     "<type>MeshNode</type>"
+                                     "<field_name>NodeIDs</field_name>",
+                                     meshes));
+
+    std::map<std::string,
+             std::unique_ptr<MathLib::PiecewiseLinearInterpolation>>
+        curves;
+    curves["linear_curve"] =
+        std::make_unique<MathLib::PiecewiseLinearInterpolation>(
+            std::vector<double>{0, 1}, std::vector<double>{0, 1}, true);
+
+    auto const parameter = constructParameterFromString(
+        "<name>parameter</name>"
+        "<type>CurveScaled</type>"
+        "<curve>linear_curve</curve>"
+        "<parameter>NodeIDs</parameter>",
+        meshes, curves);
+
+    parameter->initialize(parameters);
+
+    // The default implementation is used for the curve scaled parameter.
+    std::vector<double> values;
+    parameter->getNodalValues(0.5, {4, 0, 2}, values);
+
+    ASSERT_EQ((std::vector<double>{2, 0, 1}), values);
+}
+
+TEST_F(ParameterLibParameter, StreamedTimeSeriesNode)
+{
+    std::string const file_name =
+        TestInfoLib::TestInfo::tests_tmp_path + "StreamedTimeSeries.bin";
+    // Two components at each of the five nodes; the values of slice k are
+    // 10 * k + node id for the first component and the negative of it for
+    // the second.
+    std::vector<double> const times{0, 1, 3, 4};
+    std::vector<std::vector<double>> slices;
+    for (std::size_t k = 0; k < times.size(); ++k)
+    {
+        std::vector<double> slice;
+        for (std::size_t node_id = 0; node_id < 5; ++node_id)
+        {
+            slice.push_back(10. * k + node_id);
+            slice.push_back(-10. * k - node_id);
+        }
+        slices.push_back(slice);
+    }
+    writeTimeSeriesFile(file_name, 5, 2, times, slices);
+
+    StreamedTimeSeriesParameter const parameter(
+        "parameter", *meshes[0], file_name, MeshLib::MeshItemType::Node);
+    ASSERT_EQ(2, parameter.getNumberOfComponents());
+    ASSERT_TRUE(parameter.isTimeDependent());
+
+    ParameterLib::SpatialPosition x;
+    x.setNodeID(3);
+    // Constant before the first and after the last slice.
+    ASSERT_EQ((std::vector<double>{3, -3}), parameter(-1, x));
+    ASSERT_EQ((std::vector<double>{33, -33}), parameter(5, x));
+    // Interpolated in between, also when going back in time.
+    ASSERT_EQ((std::vector<double>{8, -8}), parameter(0.5, x));
+    ASSERT_EQ((std::vector<double>{18, -18}), parameter(2, x));
+    ASSERT_EQ((std::vector<double>{28, -28}), parameter(3.5, x));
+    ASSERT_EQ((std::vector<double>{13, -13}), parameter(1, x));
+    ASSERT_EQ((std::vector<double>{33, -33}), parameter(4, x));
+
+    x.setNodeID(0);
+    std::vector<double> values;
+    parameter.getNodalValues(2, {4, 0}, values);
+    ASSERT_EQ((std::vector<double>{19, -19, 15, -15}), values);
+
+    // The number of items has to match the mesh.
+    writeTimeSeriesFile(file_name, 4, 1, {0}, {{0, 1, 2, 3}});
+    ASSERT_ANY_THROW(StreamedTimeSeriesParameter(
+        "parameter", *meshes[0], file_name, MeshLib::MeshItemType::Node));
+    ASSERT_NO_THROW(StreamedTimeSeriesParameter(
+        "parameter", *meshes[0], file_name, MeshLib::MeshItemType::Cell));
+}
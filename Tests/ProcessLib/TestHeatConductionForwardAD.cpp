@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Fem/FiniteElement/C0IsoparametricElements.h"
+#include "NumLib/Fem/Integration/GaussLegendreIntegrationPolicy.h"
+#include "ParameterLib/ConstantParameter.h"
+#include "ProcessLib/CentralDifferencesJacobianAssembler.h"
+#include "ProcessLib/ForwardADJacobianAssembler.h"
+#include "ProcessLib/HeatConduction/HeatConductionFEM.h"
+
+TEST(ProcessLibForwardADJacobianAssembler, HeatConductionQuad4)
+{
+    using ShapeFunction = NumLib::ShapeQuad4;
+    using IntegrationMethod = NumLib::GaussLegendreIntegrationPolicy<
+        ShapeFunction::MeshElement>::IntegrationMethod;
+    using LocalAssembler =
+        ProcessLib::HeatConduction::LocalAssemblerData<ShapeFunction,
+                                                       IntegrationMethod, 2>;
+
+    // A distorted quadrilateral.
+    std::array<MeshLib::Node, 4> nodes{{MeshLib::Node(0.0, 0.0, 0.0),
+                                        MeshLib::Node(1.0, 0.1, 0.0),
+                                        MeshLib::Node(1.2, 0.9, 0.0),
+                                        MeshLib::Node(-0.1, 1.1, 0.0)}};
+    MeshLib::Quad element(std::array<MeshLib::Node*, 4>{
+        {&nodes[0], &nodes[1], &nodes[2], &nodes[3]}});
+
+    ParameterLib::ConstantParameter<double> const k("k", 3.2);
+    ParameterLib::ConstantParameter<double> const c("c", 1000.0);
+    ParameterLib::ConstantParameter<double> const rho("rho", 2.5);
+    ProcessLib::HeatConduction::HeatConductionProcessData const process_data{
+        k, c, rho};
+
+    LocalAssembler local_assembler(element, 4, false, 2, process_data);
+
+    std::vector<double> const x{273.15, 280.0, 290.5, 275.25};
+    std::vector<double> const xdot{1e-3, -2e-3, 5e-4, 0.0};
+    double const t = 0;
+    double const dt = 100;
+    double const dxdot_dx = 1 / dt;
+    double const dx_dx = 1;
+
+    ProcessLib::CentralDifferencesJacobianAssembler jac_asm_cd({1e-6});
+    std::vector<double> M_data_cd;
+    std::vector<double> K_data_cd;
+    std::vector<double> b_data_cd;
+    std::vector<double> Jac_data_cd;
+    jac_asm_cd.assembleWithJacobian(local_assembler, t, dt, x, xdot, dxdot_dx,
+                                    dx_dx, M_data_cd, K_data_cd, b_data_cd,
+                                    Jac_data_cd);
+
+    ProcessLib::ForwardADJacobianAssembler jac_asm_ad;
+    std::vector<double> M_data_ad;
+    std::vector<double> K_data_ad;
+    std::vector<double> b_data_ad;
+    std::vector<double> Jac_data_ad;
+    jac_asm_ad.assembleWithJacobian(local_assembler, t, dt, x, xdot, dxdot_dx,
+                                    dx_dx, M_data_ad, K_data_ad, b_data_ad,
+                                    Jac_data_ad);
+
+    // The forward AD assembler returns the negative residual in b.
+    auto const M = MathLib::toMatrix(M_data_cd, 4, 4);
+    auto const K = MathLib::toMatrix(K_data_cd, 4, 4);
+    Eigen::VectorXd const r =
+        M * MathLib::toVector(xdot) + K * MathLib::toVector(x);
+    ASSERT_EQ(4u, b_data_ad.size());
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_NEAR(-r[i], b_data_ad[i], 1e-10 * r.norm());
+    }
+
+    // For this linear problem the Jacobian is M dxdot/dx + K.
+    ASSERT_EQ(16u, Jac_data_cd.size());
+    ASSERT_EQ(16u, Jac_data_ad.size());
+    Eigen::MatrixXd const Jac = M * dxdot_dx + K * dx_dx;
+    for (int i = 0; i < 16; ++i)
+    {
+        EXPECT_NEAR(Jac_data_cd[i], Jac_data_ad[i], 1e-6 * Jac.norm());
+        EXPECT_NEAR(Jac(i / 4, i % 4), Jac_data_ad[i], 1e-12 * Jac.norm());
+    }
+}
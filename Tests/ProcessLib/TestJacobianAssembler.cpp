@@ -15,6 +15,7 @@
 #include "ProcessLib/LocalAssemblerInterface.h"
 #include "ProcessLib/AnalyticalJacobianAssembler.h"
 #include "ProcessLib/CentralDifferencesJacobianAssembler.h"
+#include "ProcessLib/ForwardADJacobianAssembler.h"
 
 //! Fills a vector with values whose absolute value is between \c abs_min and
 //! \c abs_max.
@@ -600,3 +601,92 @@ TYPED_TEST(ProcessLibCentralDifferencesJacobianAssembler, Test)
 {
     TestFixture::test();
 }
+
+//! Same residual as LocalAssemblerMKb<MatVecDiagXSquared, MatVecXY, MatVecXY>
+//! but evaluated with dual numbers.
+template <int N>
+class LocalAssemblerForwardAD final : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    void assembleWithJacobianForwardAD(
+        double const /*t*/, double const /*dt*/,
+        std::vector<double> const& local_x,
+        std::vector<double> const& local_xdot, const double dxdot_dx,
+        const double dx_dx, std::vector<double>& /*local_M_data*/,
+        std::vector<double>& /*local_K_data*/,
+        std::vector<double>& local_b_data,
+        std::vector<double>& local_Jac_data) override
+    {
+        ProcessLib::assembleResidualWithDualNumbers<N>(
+            [](auto const& x, auto const& x_dot, auto& r) {
+                auto x_dot_x = x[0] * x[0];
+                for (int j = 1; j < N; ++j)
+                {
+                    x_dot_x += x[j] * x[j];
+                }
+                for (int i = 0; i < N; ++i)
+                {
+                    // M = diag(x^2), K = x x^T, b = (x_i x_{N-i-1})
+                    r[i] = x[i] * x[i] * x_dot[i] + x[i] * x_dot_x -
+                           x[i] * x[N - i - 1];
+                }
+            },
+            local_x, local_xdot, dxdot_dx, dx_dx, local_b_data,
+            local_Jac_data);
+    }
+};
+
+TEST(ProcessLibForwardADJacobianAssembler, CompareWithAnalytical)
+{
+    constexpr int N = 5;
+    std::vector<double> x(N);
+    std::vector<double> xdot(N);
+    fillRandomlyConstrainedAbsoluteValues(x, 0.5, 1.5);
+    fillRandomlyConstrainedAbsoluteValues(xdot, 0.5, 1.5);
+    double const dxdot_dx = 0.7;
+    // The analytical local assembler above assumes dx/dx = 1 for the
+    // derivatives of the matrices and vectors.
+    double const dx_dx = 1.0;
+    double const t = 0.0;
+    double const dt = 0.0;
+
+    ProcessLib::AnalyticalJacobianAssembler jac_asm_ana;
+    LocalAssemblerMKb<MatVecDiagXSquared, MatVecXY, MatVecXY> loc_asm_ana;
+    std::vector<double> M_data_ana;
+    std::vector<double> K_data_ana;
+    std::vector<double> b_data_ana;
+    std::vector<double> Jac_data_ana;
+    jac_asm_ana.assembleWithJacobian(loc_asm_ana, t, dt, x, xdot, dxdot_dx,
+                                     dx_dx, M_data_ana, K_data_ana, b_data_ana,
+                                     Jac_data_ana);
+
+    ProcessLib::ForwardADJacobianAssembler jac_asm_ad;
+    LocalAssemblerForwardAD<N> loc_asm_ad;
+    std::vector<double> M_data_ad;
+    std::vector<double> K_data_ad;
+    std::vector<double> b_data_ad;
+    std::vector<double> Jac_data_ad;
+    jac_asm_ad.assembleWithJacobian(loc_asm_ad, t, dt, x, xdot, dxdot_dx,
+                                    dx_dx, M_data_ad, K_data_ad, b_data_ad,
+                                    Jac_data_ad);
+
+    // The residual is returned in b only.
+    ASSERT_TRUE(M_data_ad.empty());
+    ASSERT_TRUE(K_data_ad.empty());
+    ASSERT_EQ(static_cast<std::size_t>(N), b_data_ad.size());
+    auto const M = MathLib::toMatrix(M_data_ana, N, N);
+    auto const K = MathLib::toMatrix(K_data_ana, N, N);
+    Eigen::VectorXd const r_ana = M * MathLib::toVector(xdot) +
+                                  K * MathLib::toVector(x) -
+                                  MathLib::toVector(b_data_ana);
+    for (int i = 0; i < N; ++i)
+    {
+        EXPECT_NEAR(-r_ana[i], b_data_ad[i], 1e-14);
+    }
+
+    ASSERT_EQ(static_cast<std::size_t>(N * N), Jac_data_ad.size());
+    for (int i = 0; i < N * N; ++i)
+    {
+        EXPECT_NEAR(Jac_data_ana[i], Jac_data_ad[i], 1e-14);
+    }
+}
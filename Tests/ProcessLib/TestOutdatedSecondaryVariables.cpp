@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "ProcessLib/OutdatedSecondaryVariables.h"
+
+namespace
+{
+struct Computations
+{
+    void operator()(double const t, int const process_id)
+    {
+        calls.emplace_back(t, process_id);
+    }
+
+    std::vector<std::pair<double, int>> calls;
+};
+}  // namespace
+
+// Mimics the time loop: after each accepted time step the secondary variables
+// are marked outdated and only computed for output.
+TEST(ProcessLibOutdatedSecondaryVariables, ComputedOnlyForOutputSteps)
+{
+    Computations computations;
+    ProcessLib::OutdatedSecondaryVariables outdated(std::ref(computations));
+
+    // Nothing to compute before the first time step.
+    outdated.computeOutdated(0.0);
+    EXPECT_TRUE(computations.calls.empty());
+
+    // Time step without output.
+    outdated.markOutdated(0);
+    outdated.markOutdated(1);
+    EXPECT_TRUE(outdated.isOutdated(0));
+    EXPECT_TRUE(outdated.isOutdated(1));
+    EXPECT_TRUE(computations.calls.empty());
+
+    // Output step: computed once per process for the current time.
+    outdated.markOutdated(0);
+    outdated.markOutdated(1);
+    outdated.computeOutdated(2.0);
+    ASSERT_EQ(2u, computations.calls.size());
+    EXPECT_EQ(std::make_pair(2.0, 0), computations.calls[0]);
+    EXPECT_EQ(std::make_pair(2.0, 1), computations.calls[1]);
+    EXPECT_FALSE(outdated.isOutdated(0));
+    EXPECT_FALSE(outdated.isOutdated(1));
+
+    // Additional output at the same time, e.g., of the last time step, does
+    // not compute again.
+    outdated.computeOutdated(2.0);
+    EXPECT_EQ(2u, computations.calls.size());
+}
+
+// The failed solution of a process is written without a post time step call,
+// i.e., the secondary variables have to be updated before.
+TEST(ProcessLibOutdatedSecondaryVariables, CurrentInFailureOutput)
+{
+    Computations computations;
+    ProcessLib::OutdatedSecondaryVariables outdated(std::ref(computations));
+
+    // Accepted time step with output.
+    outdated.markOutdated(0);
+    outdated.markOutdated(1);
+    outdated.computeOutdated(1.0);
+    computations.calls.clear();
+
+    // Process 1 fails in the next time step, process 0 has no output
+    // pending.
+    EXPECT_FALSE(outdated.isOutdated(1));
+    outdated.markOutdated(1);
+    outdated.computeOutdated(1.5);
+    ASSERT_EQ(1u, computations.calls.size());
+    EXPECT_EQ(std::make_pair(1.5, 1), computations.calls[0]);
+    EXPECT_FALSE(outdated.isOutdated(0));
+    EXPECT_FALSE(outdated.isOutdated(1));
+}
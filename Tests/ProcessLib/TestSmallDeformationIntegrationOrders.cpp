@@ -0,0 +1,158 @@
+/**
+ * \file
+ * \copyright
+ * Copyright (c) 2012-2020, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "MaterialLib/SolidModels/LinearElasticIsotropic.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/Fem/FiniteElement/C0IsoparametricElements.h"
+#include "NumLib/Fem/Integration/GaussLegendreIntegrationPolicy.h"
+#include "ParameterLib/ConstantParameter.h"
+#include "ProcessLib/SmallDeformation/SmallDeformationFEM.h"
+
+namespace
+{
+using ShapeFunction = NumLib::ShapeQuad4;
+using IntegrationMethod = NumLib::GaussLegendreIntegrationPolicy<
+    ShapeFunction::MeshElement>::IntegrationMethod;
+using LocalAssembler =
+    ProcessLib::SmallDeformation::SmallDeformationLocalAssembler<
+        ShapeFunction, IntegrationMethod, 2>;
+using ProcessData =
+    ProcessLib::SmallDeformation::SmallDeformationProcessData<2>;
+
+struct ProcessLibSmallDeformationIntegrationOrders : public ::testing::Test
+{
+    // Two elements, the first one with material id 0, the second one with
+    // material id 1.
+    ProcessLibSmallDeformationIntegrationOrders()
+        : mesh(MeshLib::MeshGenerator::generateRegularQuadMesh(2u, 1u, 1.0))
+    {
+        material_ids = mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell);
+        material_ids->push_back(0);
+        material_ids->push_back(1);
+
+        MeshLib::MeshSubset const nodes_subset(*mesh, mesh->getNodes());
+        std::vector<MeshLib::MeshSubset> components{nodes_subset,
+                                                    nodes_subset};
+        dof_table = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+            std::move(components), NumLib::ComponentOrder::BY_COMPONENT);
+    }
+
+    ProcessData createProcessData(
+        std::map<int, unsigned> integration_orders_per_material) const
+    {
+        std::map<int,
+                 std::unique_ptr<MaterialLib::Solids::MechanicsBase<2>>>
+            solid_materials;
+        solid_materials.emplace(
+            0, std::make_unique<MaterialLib::Solids::LinearElasticIsotropic<2>>(
+                   MaterialLib::Solids::LinearElasticIsotropic<
+                       2>::MaterialProperties{youngs_modulus,
+                                              poissons_ratio}));
+        return ProcessData{material_ids,
+                           std::move(solid_materials),
+                           nullptr,
+                           density,
+                           Eigen::Vector2d{0, -9.81},
+                           293.15,
+                           std::move(integration_orders_per_material)};
+    }
+
+    // Assembles the local residual and Jacobian of a distorted displacement
+    // field.
+    void assemble(LocalAssembler& local_assembler,
+                  MeshLib::Element const& element,
+                  std::vector<double>& b_data,
+                  std::vector<double>& Jac_data) const
+    {
+        local_assembler.initialize(element.getID(), *dof_table);
+        std::vector<double> const x{0.0,  1e-3, 2e-3, -1e-3,
+                                    0.0,  5e-4, 1e-3, -2e-3};
+        std::vector<double> const xdot(x.size(), 0.0);
+        std::vector<double> M_data;
+        std::vector<double> K_data;
+        local_assembler.assembleWithJacobian(0, 1, x, xdot, 0, 1, M_data,
+                                             K_data, b_data, Jac_data);
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    MeshLib::PropertyVector<int>* material_ids = nullptr;
+    std::unique_ptr<NumLib::LocalToGlobalIndexMap> dof_table;
+
+    ParameterLib::ConstantParameter<double> const youngs_modulus{"E", 1e9};
+    ParameterLib::ConstantParameter<double> const poissons_ratio{"nu", 0.25};
+    ParameterLib::ConstantParameter<double> const density{"rho", 2e3};
+};
+}  // namespace
+
+TEST_F(ProcessLibSmallDeformationIntegrationOrders, NumberOfIntegrationPoints)
+{
+    // Material id 1 is integrated with order 3, all other material ids with
+    // the process' integration order 2.
+    auto process_data = createProcessData({{1, 3}});
+
+    LocalAssembler local_assembler_0(*mesh->getElement(0), 8, false, 2,
+                                     process_data);
+    LocalAssembler local_assembler_1(*mesh->getElement(1), 8, false, 2,
+                                     process_data);
+
+    EXPECT_EQ(4u, local_assembler_0.getNumberOfIntegrationPoints());
+    EXPECT_EQ(9u, local_assembler_1.getNumberOfIntegrationPoints());
+}
+
+TEST_F(ProcessLibSmallDeformationIntegrationOrders, SameResultsAsUniformOrders)
+{
+    auto process_data = createProcessData({{1, 3}});
+    auto uniform_process_data = createProcessData({});
+
+    // Where the integration orders coincide, the local assemblers yield the
+    // same results as with uniform integration orders.
+    std::array<unsigned, 2> const uniform_orders{{2, 3}};
+    for (std::size_t element_id = 0; element_id < 2; ++element_id)
+    {
+        auto const& element = *mesh->getElement(element_id);
+        LocalAssembler local_assembler(element, 8, false, 2, process_data);
+        LocalAssembler uniform_local_assembler(element, 8, false,
+                                               uniform_orders[element_id],
+                                               uniform_process_data);
+        ASSERT_EQ(uniform_local_assembler.getNumberOfIntegrationPoints(),
+                  local_assembler.getNumberOfIntegrationPoints());
+
+        std::vector<double> b_data;
+        std::vector<double> Jac_data;
+        assemble(local_assembler, element, b_data, Jac_data);
+
+        std::vector<double> uniform_b_data;
+        std::vector<double> uniform_Jac_data;
+        assemble(uniform_local_assembler, element, uniform_b_data,
+                 uniform_Jac_data);
+
+        ASSERT_EQ(uniform_b_data.size(), b_data.size());
+        for (std::size_t i = 0; i < b_data.size(); ++i)
+        {
+            EXPECT_DOUBLE_EQ(uniform_b_data[i], b_data[i]);
+        }
+        ASSERT_EQ(uniform_Jac_data.size(), Jac_data.size());
+        for (std::size_t i = 0; i < Jac_data.size(); ++i)
+        {
+            EXPECT_DOUBLE_EQ(uniform_Jac_data[i], Jac_data[i]);
+        }
+    }
+}